@@ -0,0 +1,189 @@
+#include <benchmark/benchmark.h>
+#include "libEmbedded/Buffer.h"
+#include "libEmbedded/Helpers.h"
+#include "libEmbedded/AtomicBufferStats.h"
+
+using libEmbedded::Buffer;
+constexpr size_t kByteBufferSize = 4096;
+using ByteBuffer = Buffer<uint8_t, kByteBufferSize>;
+
+static void FillBytes(ByteBuffer &buffer)
+{
+    for (size_t i = 0; i < kByteBufferSize + kByteBufferSize / 3; i++)
+    {
+        buffer.Add(static_cast<uint8_t>(i));
+    }
+}
+
+static void ByteBufferCopyConstruct(benchmark::State &state)
+{
+    ByteBuffer source;
+    FillBytes(source);
+    for (auto _ : state)
+    {
+        ByteBuffer copy(source);
+        benchmark::DoNotOptimize(copy);
+    }
+    state.SetBytesProcessed(state.iterations() * kByteBufferSize);
+}
+BENCHMARK(ByteBufferCopyConstruct);
+
+static void ByteBufferAssign(benchmark::State &state)
+{
+    ByteBuffer source;
+    ByteBuffer target;
+    FillBytes(source);
+    for (auto _ : state)
+    {
+        target = source;
+        benchmark::DoNotOptimize(target);
+    }
+    state.SetBytesProcessed(state.iterations() * kByteBufferSize);
+}
+BENCHMARK(ByteBufferAssign);
+
+static void ByteBufferAddRange(benchmark::State &state)
+{
+    ByteBuffer buffer;
+    uint8_t chunk[1500] = {0};
+    for (auto _ : state)
+    {
+        buffer.AddRange(chunk, sizeof(chunk));
+        benchmark::DoNotOptimize(buffer);
+    }
+    state.SetBytesProcessed(state.iterations() * sizeof(chunk));
+}
+BENCHMARK(ByteBufferAddRange);
+
+static void ByteBufferCompare(benchmark::State &state)
+{
+    ByteBuffer a;
+    FillBytes(a);
+    ByteBuffer b(a);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(a == b);
+    }
+    state.SetBytesProcessed(state.iterations() * kByteBufferSize);
+}
+BENCHMARK(ByteBufferCompare);
+
+// Sum all elements per contiguous segment, the way a vectorized kernel walks over the buffer contents.
+template <size_t TAlignment>
+static int32_t SumSegment(const int32_t *data, size_t count)
+{
+#if defined(__GNUC__)
+    data = static_cast<const int32_t *>(__builtin_assume_aligned(data, TAlignment));
+#endif
+    int32_t sum = 0;
+    for (size_t i = 0; i < count; i++)
+    {
+        sum += data[i];
+    }
+    return sum;
+}
+
+constexpr size_t kIntBufferSize = 4096;
+
+// The old workspace was a plain char array, emulate that by starting it one byte into the storage.
+static void IntSumUnaligned(benchmark::State &state)
+{
+    static char storage[kIntBufferSize * sizeof(int32_t) + 1];
+    int32_t *data = reinterpret_cast<int32_t *>(storage + 1);
+    for (size_t i = 0; i < kIntBufferSize; i++)
+    {
+        data[i] = static_cast<int32_t>(i);
+    }
+    size_t count = kIntBufferSize;
+    for (auto _ : state)
+    {
+        // Hide the count from the compiler, just like the segment sizes of the Buffer.
+        benchmark::DoNotOptimize(count);
+        benchmark::DoNotOptimize(SumSegment<1>(data, count));
+    }
+    state.SetBytesProcessed(state.iterations() * kIntBufferSize * sizeof(int32_t));
+}
+BENCHMARK(IntSumUnaligned);
+
+template <size_t TAlignment>
+static void IntSumBuffer(benchmark::State &state)
+{
+    static Buffer<int32_t, kIntBufferSize, TAlignment> buffer;
+    for (size_t i = 0; i < kIntBufferSize; i++)
+    {
+        buffer.Add(static_cast<int32_t>(i));
+    }
+    for (auto _ : state)
+    {
+        libEmbedded::BufferSegments<const int32_t> segments = buffer.Peek();
+        int32_t sum = SumSegment<TAlignment>(segments.first.begin(), segments.first.end() - segments.first.begin());
+        sum += SumSegment<TAlignment>(segments.second.begin(), segments.second.end() - segments.second.begin());
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetBytesProcessed(state.iterations() * kIntBufferSize * sizeof(int32_t));
+}
+BENCHMARK_TEMPLATE(IntSumBuffer, alignof(int32_t));
+BENCHMARK_TEMPLATE(IntSumBuffer, libEmbedded::kCacheLineSize);
+
+template <typename TStats>
+static void ByteBufferAddWithStats(benchmark::State &state)
+{
+    static Buffer<uint8_t, kByteBufferSize, alignof(uint8_t), libEmbedded::OverflowPolicy::DROP_OLDEST, TStats> buffer;
+    uint8_t value = 0;
+    for (auto _ : state)
+    {
+        buffer.Add(value++);
+    }
+    benchmark::DoNotOptimize(buffer);
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_TEMPLATE(ByteBufferAddWithStats, libEmbedded::NoBufferStats);
+BENCHMARK_TEMPLATE(ByteBufferAddWithStats, libEmbedded::BufferStats);
+BENCHMARK_TEMPLATE(ByteBufferAddWithStats, libEmbedded::AtomicBufferStats);
+
+// Pairs of a power of two capacity (mask) and a size right next to it (compare and subtract).
+template <typename T, size_t TNumElements>
+static void BufferAddFull(benchmark::State &state)
+{
+    static Buffer<T, TNumElements> buffer;
+    T value = 0;
+    for (auto _ : state)
+    {
+        buffer.Add(value++);
+    }
+    benchmark::DoNotOptimize(buffer);
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_TEMPLATE(BufferAddFull, uint8_t, 256);
+BENCHMARK_TEMPLATE(BufferAddFull, uint8_t, 255);
+BENCHMARK_TEMPLATE(BufferAddFull, uint32_t, 4096);
+BENCHMARK_TEMPLATE(BufferAddFull, uint32_t, 4095);
+BENCHMARK_TEMPLATE(BufferAddFull, uint32_t, 1024);
+BENCHMARK_TEMPLATE(BufferAddFull, uint32_t, 1000);
+
+template <typename T, size_t TNumElements>
+static void BufferIndexedSum(benchmark::State &state)
+{
+    static Buffer<T, TNumElements> buffer;
+    // Fill one and a half times so the contents wrap.
+    for (size_t i = 0; i < TNumElements + TNumElements / 2; i++)
+    {
+        buffer.Add(static_cast<T>(i));
+    }
+    for (auto _ : state)
+    {
+        uint32_t sum = 0;
+        for (size_t i = 0; i < buffer.Size(); i++)
+        {
+            sum += buffer[i];
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * TNumElements);
+}
+BENCHMARK_TEMPLATE(BufferIndexedSum, uint8_t, 256);
+BENCHMARK_TEMPLATE(BufferIndexedSum, uint8_t, 255);
+BENCHMARK_TEMPLATE(BufferIndexedSum, uint32_t, 4096);
+BENCHMARK_TEMPLATE(BufferIndexedSum, uint32_t, 4095);
+BENCHMARK_TEMPLATE(BufferIndexedSum, uint32_t, 1024);
+BENCHMARK_TEMPLATE(BufferIndexedSum, uint32_t, 1000);
@@ -0,0 +1,77 @@
+#include <benchmark/benchmark.h>
+#include "libEmbedded/Buffer.h"
+#include "libEmbedded/CompressedBuffer.h"
+
+// Both buffers get the same 16 KiB footprint.
+constexpr size_t kBytes = 16 * 1024;
+constexpr size_t kBlockSize = 64;
+
+static int32_t NextSample(uint32_t &state, int32_t previous, int32_t step)
+{
+    state = state * 1664525u + 1013904223u;
+    return previous + static_cast<int32_t>((state >> 16) % static_cast<uint32_t>(2 * step + 1)) - step;
+}
+
+template <typename TBuffer>
+static void Fill(TBuffer &buffer, int32_t step)
+{
+    uint32_t seed = 1;
+    int32_t value = 20000;
+    for (size_t i = 0; i < 4 * kBytes; i++)
+    {
+        value = NextSample(seed, value, step);
+        buffer.Add(value);
+    }
+}
+
+// The compression ratio is reported as the samples held relative to a Buffer of the same size.
+static void CompressedBufferAdd(benchmark::State &state)
+{
+    const int32_t step = static_cast<int32_t>(state.range(0));
+    libEmbedded::CompressedBuffer<int32_t, kBytes / kBlockSize, kBlockSize> buffer;
+    uint32_t seed = 1;
+    int32_t value = 20000;
+    for (auto _ : state)
+    {
+        value = NextSample(seed, value, step);
+        buffer.Add(value);
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.counters["ratio"] = static_cast<double>(buffer.Size()) / (kBytes / sizeof(int32_t));
+}
+BENCHMARK(CompressedBufferAdd)->Arg(4)->Arg(60)->Arg(1000)->Arg(1 << 20);
+
+static void BufferDecode(benchmark::State &state)
+{
+    libEmbedded::Buffer<int32_t, kBytes / sizeof(int32_t)> buffer;
+    Fill(buffer, 60);
+    for (auto _ : state)
+    {
+        int64_t sum = 0;
+        for (int32_t value : buffer)
+        {
+            sum += value;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * buffer.Size());
+}
+BENCHMARK(BufferDecode);
+
+static void CompressedBufferDecode(benchmark::State &state)
+{
+    libEmbedded::CompressedBuffer<int32_t, kBytes / kBlockSize, kBlockSize> buffer;
+    Fill(buffer, static_cast<int32_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        int64_t sum = 0;
+        for (int32_t value : buffer)
+        {
+            sum += value;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * buffer.Size());
+    state.counters["ratio"] = static_cast<double>(buffer.Size()) / (kBytes / sizeof(int32_t));
+}
+BENCHMARK(CompressedBufferDecode)->Arg(4)->Arg(60)->Arg(1000);
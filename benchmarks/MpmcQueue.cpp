@@ -0,0 +1,64 @@
+#include <benchmark/benchmark.h>
+#include "libEmbedded/MpmcQueue.h"
+#include "libEmbedded/Buffer.h"
+#include <mutex>
+#include <thread>
+
+using libEmbedded::Buffer;
+using libEmbedded::MpmcQueue;
+using T = uint32_t;
+constexpr size_t kQueueSize = 1024;
+constexpr int kMaxThreads = 16;
+
+// The setup this queue replaces: a Buffer guarded by a mutex.
+struct MutexBuffer
+{
+    std::mutex lock;
+    Buffer<T, kQueueSize> buffer;
+
+    bool TryPush(T value)
+    {
+        std::lock_guard<std::mutex> guard(this->lock);
+        if (this->buffer.Size() == this->buffer.Capacity())
+        {
+            return false;
+        }
+        this->buffer.Add(value);
+        return true;
+    }
+
+    bool TryPop(T &value)
+    {
+        std::lock_guard<std::mutex> guard(this->lock);
+        if (this->buffer.Size() == 0)
+        {
+            return false;
+        }
+        value = this->buffer[0];
+        this->buffer.Remove(1);
+        return true;
+    }
+};
+
+// Every thread is both a producer and a consumer so the queue never runs full or empty for long.
+template <typename TQueue>
+static void PushPopPairs(benchmark::State &state)
+{
+    static TQueue queue;
+    T value = 0;
+    for (auto _ : state)
+    {
+        while (!queue.TryPush(value))
+        {
+            std::this_thread::yield();
+        }
+        while (!queue.TryPop(value))
+        {
+            std::this_thread::yield();
+        }
+    }
+    benchmark::DoNotOptimize(value);
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_TEMPLATE(PushPopPairs, MutexBuffer)->ThreadRange(1, kMaxThreads)->UseRealTime();
+BENCHMARK_TEMPLATE(PushPopPairs, MpmcQueue<T, kQueueSize>)->ThreadRange(1, kMaxThreads)->UseRealTime();
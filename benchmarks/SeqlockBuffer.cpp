@@ -0,0 +1,62 @@
+#include <benchmark/benchmark.h>
+#include "libEmbedded/SeqlockBuffer.h"
+#include "libEmbedded/Buffer.h"
+#include <mutex>
+
+using libEmbedded::Buffer;
+using libEmbedded::SeqlockBuffer;
+using T = uint32_t;
+constexpr size_t kBufferSize = 64;
+
+// The setup this replaces: a Buffer guarded by a mutex that readers copy under the lock.
+struct MutexSnapshotBuffer
+{
+    typedef Buffer<T, kBufferSize> BufferType;
+    mutable std::mutex lock;
+    BufferType buffer;
+
+    void Add(T value)
+    {
+        std::lock_guard<std::mutex> guard(this->lock);
+        this->buffer.Add(value);
+    }
+
+    void Read(BufferType &snapshot) const
+    {
+        std::lock_guard<std::mutex> guard(this->lock);
+        snapshot = this->buffer;
+    }
+};
+
+template <typename TBuffer>
+static void SnapshotWriterAdd(benchmark::State &state)
+{
+    static TBuffer buffer;
+    T value = 0;
+    for (auto _ : state)
+    {
+        buffer.Add(value++);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_TEMPLATE(SnapshotWriterAdd, MutexSnapshotBuffer);
+BENCHMARK_TEMPLATE(SnapshotWriterAdd, SeqlockBuffer<T, kBufferSize>);
+
+template <typename TBuffer>
+static void SnapshotRead(benchmark::State &state)
+{
+    static TBuffer buffer;
+    for (T i = 0; i < kBufferSize + kBufferSize / 2; i++)
+    {
+        buffer.Add(i);
+    }
+    typename TBuffer::BufferType snapshot;
+    for (auto _ : state)
+    {
+        buffer.Read(snapshot);
+        benchmark::DoNotOptimize(snapshot);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_TEMPLATE(SnapshotRead, MutexSnapshotBuffer);
+BENCHMARK_TEMPLATE(SnapshotRead, SeqlockBuffer<T, kBufferSize>);
@@ -0,0 +1,50 @@
+#include <benchmark/benchmark.h>
+#include "libEmbedded/Buffer.h"
+#include "libEmbedded/SlidingWindow.h"
+
+constexpr size_t kWindowSize = 256;
+
+static int32_t NextSample(uint32_t &state)
+{
+    state = state * 1664525u + 1013904223u;
+    return static_cast<int32_t>(state >> 16);
+}
+
+static void WindowRecomputeEverySample(benchmark::State &state)
+{
+    libEmbedded::Buffer<int32_t, kWindowSize> window;
+    uint32_t seed = 1;
+    for (auto _ : state)
+    {
+        window.Add(NextSample(seed));
+        int64_t sum = 0;
+        int32_t minimum = window[0];
+        int32_t maximum = window[0];
+        for (int32_t value : window)
+        {
+            sum += value;
+            minimum = value < minimum ? value : minimum;
+            maximum = value > maximum ? value : maximum;
+        }
+        benchmark::DoNotOptimize(sum);
+        benchmark::DoNotOptimize(minimum);
+        benchmark::DoNotOptimize(maximum);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(WindowRecomputeEverySample);
+
+static void WindowIncremental(benchmark::State &state)
+{
+    libEmbedded::SlidingWindow<int32_t, kWindowSize, int64_t> window;
+    uint32_t seed = 1;
+    for (auto _ : state)
+    {
+        window.Add(NextSample(seed));
+        benchmark::DoNotOptimize(window.Sum());
+        benchmark::DoNotOptimize(window.Min());
+        benchmark::DoNotOptimize(window.Max());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(WindowIncremental);
@@ -0,0 +1,58 @@
+#include <benchmark/benchmark.h>
+#include "libEmbedded/Buffer.h"
+#include "libEmbedded/SoaBuffer.h"
+
+constexpr size_t kRecords = 4096;
+
+struct Record
+{
+    uint64_t timestamp;
+    float x;
+    float y;
+    float z;
+    uint32_t status;
+};
+
+static void AosBufferScaleOneField(benchmark::State &state)
+{
+    libEmbedded::Buffer<Record, kRecords> buffer;
+    for (size_t i = 0; i < kRecords; i++)
+    {
+        buffer.Add(Record{i, static_cast<float>(i), 1.0f, 2.0f, 0});
+    }
+    for (auto _ : state)
+    {
+        for (Record &record : buffer)
+        {
+            record.x = record.x * 0.5f + 1.0f;
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * kRecords);
+}
+BENCHMARK(AosBufferScaleOneField);
+
+static void SoaBufferScaleOneField(benchmark::State &state)
+{
+    libEmbedded::SoaBuffer<kRecords, uint64_t, float, float, float, uint32_t> buffer;
+    for (size_t i = 0; i < kRecords; i++)
+    {
+        buffer.Add(i, static_cast<float>(i), 1.0f, 2.0f, 0);
+    }
+    buffer.Linearize();
+    for (auto _ : state)
+    {
+        libEmbedded::BufferSegments<float> x = buffer.GetColumn<1>();
+        for (float &value : x.first)
+        {
+            value = value * 0.5f + 1.0f;
+        }
+        for (float &value : x.second)
+        {
+            value = value * 0.5f + 1.0f;
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * kRecords);
+}
+BENCHMARK(SoaBufferScaleOneField);
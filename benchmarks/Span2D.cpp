@@ -0,0 +1,60 @@
+#include <benchmark/benchmark.h>
+#include "libEmbedded/Span2D.h"
+#include <stdint.h>
+#include <vector>
+
+using libEmbedded::Span2D;
+
+constexpr size_t kSize = 2048;
+constexpr size_t kTile = 32;
+
+static void Span2DTransposeNaive(benchmark::State &state)
+{
+    std::vector<uint16_t> source(kSize * kSize, 1);
+    std::vector<uint16_t> destination(kSize * kSize);
+    Span2D<const uint16_t> in(source.data(), kSize, kSize);
+    Span2D<uint16_t> out(destination.data(), kSize, kSize);
+    for (auto _ : state)
+    {
+        for (size_t row = 0; row < kSize; row++)
+        {
+            for (size_t column = 0; column < kSize; column++)
+            {
+                out(column, row) = in(row, column);
+            }
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * kSize * kSize * sizeof(uint16_t));
+}
+BENCHMARK(Span2DTransposeNaive);
+
+static void Span2DTransposeTiled(benchmark::State &state)
+{
+    std::vector<uint16_t> source(kSize * kSize, 1);
+    std::vector<uint16_t> destination(kSize * kSize);
+    Span2D<const uint16_t> in(source.data(), kSize, kSize);
+    Span2D<uint16_t> out(destination.data(), kSize, kSize);
+    for (auto _ : state)
+    {
+        libEmbedded::Span2DTiles<const uint16_t> tiles = in.Tiles(kTile, kTile);
+        for (size_t tileRow = 0; tileRow < tiles.TileRows(); tileRow++)
+        {
+            for (size_t tileColumn = 0; tileColumn < tiles.TileColumns(); tileColumn++)
+            {
+                Span2D<const uint16_t> tile = tiles.Tile(tileRow, tileColumn);
+                Span2D<uint16_t> target = out.Subview(tileColumn * kTile, tileRow * kTile, tile.Columns(), tile.Rows());
+                for (size_t row = 0; row < tile.Rows(); row++)
+                {
+                    for (size_t column = 0; column < tile.Columns(); column++)
+                    {
+                        target(column, row) = tile(row, column);
+                    }
+                }
+            }
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * kSize * kSize * sizeof(uint16_t));
+}
+BENCHMARK(Span2DTransposeTiled);
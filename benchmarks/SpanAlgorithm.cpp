@@ -0,0 +1,100 @@
+#include <benchmark/benchmark.h>
+#include "libEmbedded/Span.h"
+#include "libEmbedded/SpanAlgorithm.h"
+#include <stdint.h>
+#include <vector>
+
+using libEmbedded::Span;
+
+// The naive loops are what the algorithms replace, noinline so the compiler does not turn them into the libc call.
+__attribute__((noinline)) static bool NaiveEqual(Span<const uint8_t> a, Span<const uint8_t> b)
+{
+    if (libEmbedded::Distance(a) != libEmbedded::Distance(b))
+    {
+        return false;
+    }
+    for (size_t i = 0; i < libEmbedded::Distance(a); i++)
+    {
+        if (a[i] != b[i])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+__attribute__((noinline)) static const uint8_t *NaiveFind(Span<const uint8_t> span, uint8_t value)
+{
+    for (const uint8_t *it = span.begin(); it != span.end(); ++it)
+    {
+        if (*it == value)
+        {
+            return it;
+        }
+    }
+    return span.end();
+}
+
+static void SpanEqualNaive(benchmark::State &state)
+{
+    const size_t size = static_cast<size_t>(state.range(0));
+    std::vector<uint8_t> a(size, 7);
+    std::vector<uint8_t> b(size, 7);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(NaiveEqual(Span<const uint8_t>(a.data(), size), Span<const uint8_t>(b.data(), size)));
+    }
+    state.SetBytesProcessed(state.iterations() * size);
+}
+BENCHMARK(SpanEqualNaive)->RangeMultiplier(16)->Range(16, 1 << 20);
+
+static void SpanEqual(benchmark::State &state)
+{
+    const size_t size = static_cast<size_t>(state.range(0));
+    std::vector<uint8_t> a(size, 7);
+    std::vector<uint8_t> b(size, 7);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(libEmbedded::Equal(Span<const uint8_t>(a.data(), size), Span<const uint8_t>(b.data(), size)));
+    }
+    state.SetBytesProcessed(state.iterations() * size);
+}
+BENCHMARK(SpanEqual)->RangeMultiplier(16)->Range(16, 1 << 20);
+
+static void SpanFindNaive(benchmark::State &state)
+{
+    const size_t size = static_cast<size_t>(state.range(0));
+    std::vector<uint8_t> data(size, 7);
+    data[size - 1] = 9;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(NaiveFind(Span<const uint8_t>(data.data(), size), 9));
+    }
+    state.SetBytesProcessed(state.iterations() * size);
+}
+BENCHMARK(SpanFindNaive)->RangeMultiplier(16)->Range(16, 1 << 20);
+
+static void SpanFind(benchmark::State &state)
+{
+    const size_t size = static_cast<size_t>(state.range(0));
+    std::vector<uint8_t> data(size, 7);
+    data[size - 1] = 9;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(libEmbedded::Find(Span<const uint8_t>(data.data(), size), 9));
+    }
+    state.SetBytesProcessed(state.iterations() * size);
+}
+BENCHMARK(SpanFind)->RangeMultiplier(16)->Range(16, 1 << 20);
+
+static void SpanCount(benchmark::State &state)
+{
+    const size_t size = static_cast<size_t>(state.range(0));
+    std::vector<uint8_t> data(size, 7);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(libEmbedded::Count(Span<const uint8_t>(data.data(), size), 7));
+    }
+    state.SetBytesProcessed(state.iterations() * size);
+}
+BENCHMARK(SpanCount)->RangeMultiplier(16)->Range(16, 1 << 20);
@@ -0,0 +1,119 @@
+#include <benchmark/benchmark.h>
+#include "libEmbedded/SpscQueue.h"
+#include "libEmbedded/Buffer.h"
+#include <mutex>
+#include <thread>
+
+using libEmbedded::Buffer;
+using libEmbedded::SpscQueue;
+using T = uint32_t;
+constexpr size_t kQueueSize = 1024;
+constexpr T kItemCount = 1 << 20;
+
+// The setup this queue replaces: a Buffer guarded by a mutex.
+struct MutexBuffer
+{
+    std::mutex lock;
+    Buffer<T, kQueueSize> buffer;
+
+    bool TryPush(T value)
+    {
+        std::lock_guard<std::mutex> guard(this->lock);
+        if (this->buffer.Size() == this->buffer.Capacity())
+        {
+            return false;
+        }
+        this->buffer.Add(value);
+        return true;
+    }
+
+    bool TryPop(T &value)
+    {
+        std::lock_guard<std::mutex> guard(this->lock);
+        if (this->buffer.Size() == 0)
+        {
+            return false;
+        }
+        value = this->buffer[0];
+        this->buffer.Remove(1);
+        return true;
+    }
+};
+
+template <typename TQueue>
+static void TwoThreadSingleElement(benchmark::State &state)
+{
+    static TQueue queue;
+    for (auto _ : state)
+    {
+        std::thread producer([]() {
+            for (T i = 0; i < kItemCount;)
+            {
+                if (queue.TryPush(i))
+                {
+                    i++;
+                }
+                else
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+        T value = 0;
+        for (T i = 0; i < kItemCount;)
+        {
+            if (queue.TryPop(value))
+            {
+                i++;
+            }
+            else
+            {
+                std::this_thread::yield();
+            }
+        }
+        producer.join();
+        benchmark::DoNotOptimize(value);
+    }
+    state.SetItemsProcessed(state.iterations() * kItemCount);
+}
+BENCHMARK_TEMPLATE(TwoThreadSingleElement, MutexBuffer)->UseRealTime();
+BENCHMARK_TEMPLATE(TwoThreadSingleElement, SpscQueue<T, kQueueSize>)->UseRealTime();
+
+static void SpscQueueTwoThreadBulk(benchmark::State &state)
+{
+    static SpscQueue<T, kQueueSize> queue;
+    const size_t batchSize = static_cast<size_t>(state.range(0));
+    for (auto _ : state)
+    {
+        std::thread producer([batchSize]() {
+            T batch[256];
+            for (T i = 0; i < batchSize; i++)
+            {
+                batch[i] = i;
+            }
+            for (T sent = 0; sent < kItemCount;)
+            {
+                const size_t pushed = queue.TryPushRange(batch, batchSize);
+                if (pushed == 0)
+                {
+                    std::this_thread::yield();
+                }
+                sent += pushed;
+            }
+        });
+        T batch[256];
+        for (T received = 0; received < kItemCount;)
+        {
+            const size_t popped = queue.TryPopRange(batch, batchSize);
+            if (popped == 0)
+            {
+                std::this_thread::yield();
+            }
+            received += popped;
+        }
+        producer.join();
+        benchmark::DoNotOptimize(batch);
+    }
+    state.SetItemsProcessed(state.iterations() * kItemCount);
+}
+BENCHMARK(SpscQueueTwoThreadBulk)->Arg(8)->Arg(64)->Arg(256)->UseRealTime();
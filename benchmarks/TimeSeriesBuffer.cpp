@@ -0,0 +1,85 @@
+#include <benchmark/benchmark.h>
+#include "libEmbedded/Buffer.h"
+#include "libEmbedded/TimeSeriesBuffer.h"
+
+// Both buffers get the same 16 KiB footprint.
+constexpr size_t kBytes = 16 * 1024;
+constexpr size_t kBlockSize = 256;
+
+struct Sample
+{
+    uint64_t timestamp;
+    double value;
+};
+
+// A 10 Hz sensor, range(0) is the resolution in 1/N degrees (0 for a full precision noisy value).
+static Sample NextSample(uint32_t &state, uint64_t index, int64_t resolution)
+{
+    state = state * 1664525u + 1013904223u;
+    double value = 20.0 + static_cast<double>(state >> 16) / 65536.0;
+    if (resolution > 0)
+    {
+        value = 20.0 + static_cast<double>(static_cast<int64_t>((index / 10) % 8)) / static_cast<double>(resolution);
+    }
+    return {1700000000000 + 100 * index, value};
+}
+
+// The compression ratio is reported as the points held relative to a Buffer of the same size.
+static void TimeSeriesBufferAdd(benchmark::State &state)
+{
+    libEmbedded::TimeSeriesBuffer<kBytes / kBlockSize, kBlockSize> buffer;
+    uint32_t seed = 1;
+    uint64_t index = 0;
+    for (auto _ : state)
+    {
+        const Sample sample = NextSample(seed, index++, state.range(0));
+        buffer.Add(sample.timestamp, sample.value);
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.counters["ratio"] = static_cast<double>(buffer.Size()) / (kBytes / sizeof(Sample));
+}
+BENCHMARK(TimeSeriesBufferAdd)->Arg(16)->Arg(0);
+
+static void TimeSeriesPlainBufferDecode(benchmark::State &state)
+{
+    libEmbedded::Buffer<Sample, kBytes / sizeof(Sample)> buffer;
+    uint32_t seed = 1;
+    for (uint64_t i = 0; i < buffer.Capacity(); i++)
+    {
+        buffer.Add(NextSample(seed, i, 16));
+    }
+    for (auto _ : state)
+    {
+        double sum = 0;
+        for (const Sample &sample : buffer)
+        {
+            sum += sample.value;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * buffer.Size());
+}
+BENCHMARK(TimeSeriesPlainBufferDecode);
+
+static void TimeSeriesBufferDecode(benchmark::State &state)
+{
+    libEmbedded::TimeSeriesBuffer<kBytes / kBlockSize, kBlockSize> buffer;
+    uint32_t seed = 1;
+    for (uint64_t i = 0; i < 40 * kBytes; i++)
+    {
+        const Sample sample = NextSample(seed, i, state.range(0));
+        buffer.Add(sample.timestamp, sample.value);
+    }
+    for (auto _ : state)
+    {
+        double sum = 0;
+        for (const libEmbedded::TimeSeriesPoint &point : buffer)
+        {
+            sum += point.value;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * buffer.Size());
+    state.counters["ratio"] = static_cast<double>(buffer.Size()) / (kBytes / sizeof(Sample));
+}
+BENCHMARK(TimeSeriesBufferDecode)->Arg(16)->Arg(0);
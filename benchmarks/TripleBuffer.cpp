@@ -0,0 +1,71 @@
+#include <benchmark/benchmark.h>
+#include "libEmbedded/TripleBuffer.h"
+#include <mutex>
+
+using libEmbedded::TripleBuffer;
+
+struct Pose
+{
+    double position[3];
+    double orientation[4];
+    uint64_t timestamp;
+};
+
+// The setup this replaces: a struct guarded by a mutex that is copied in and out under the lock.
+struct MutexLatestValue
+{
+    mutable std::mutex lock;
+    Pose value;
+
+    void Write(const Pose &pose)
+    {
+        std::lock_guard<std::mutex> guard(this->lock);
+        this->value = pose;
+    }
+
+    Pose Read() const
+    {
+        std::lock_guard<std::mutex> guard(this->lock);
+        return this->value;
+    }
+};
+
+template <typename TLatest>
+static void LatestValueWrite(benchmark::State &state)
+{
+    static TLatest latest;
+    Pose pose = {};
+    for (auto _ : state)
+    {
+        pose.timestamp++;
+        latest.Write(pose);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_TEMPLATE(LatestValueWrite, MutexLatestValue);
+BENCHMARK_TEMPLATE(LatestValueWrite, TripleBuffer<Pose>);
+
+static void LatestValueReadMutex(benchmark::State &state)
+{
+    static MutexLatestValue latest;
+    for (auto _ : state)
+    {
+        Pose pose = latest.Read();
+        benchmark::DoNotOptimize(pose);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(LatestValueReadMutex);
+
+static void LatestValueReadTripleBuffer(benchmark::State &state)
+{
+    static TripleBuffer<Pose> latest;
+    for (auto _ : state)
+    {
+        // No copy needed, the front slot stays valid until the next Read.
+        const Pose &pose = latest.Read();
+        benchmark::DoNotOptimize(pose.timestamp);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(LatestValueReadTripleBuffer);
@@ -0,0 +1,105 @@
+/**
+ * @file AtomicBufferStats.h
+ * @author Giel Willemsen
+ * @brief Stats policy for Buffer whose numbers can be read (and reset) from a monitoring thread.
+ * @version 0.1 2026-10-17 Initial version
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * @details
+ * A Buffer itself is not thread safe, so there is only ever one thread that records. That thread can update
+ * each counter with a relaxed load and store instead of a (locked) read-modify-write, so recording costs about
+ * the same as with the plain BufferStats. Because of that the monitoring thread can't just zero the counters,
+ * the writer could overwrite that right away. Reset instead remembers the current values and Snapshot reports
+ * the difference, so Snapshot and Reset should be called from one monitoring thread.
+ */
+#pragma once
+#ifndef LIBEMBEDDED_ATOMIC_BUFFER_STATS_H
+#define LIBEMBEDDED_ATOMIC_BUFFER_STATS_H
+#include <stddef.h>
+#include <atomic>
+#include "libEmbedded/BufferStats.h"
+
+namespace libEmbedded
+{
+    /**
+     * @brief Stats policy with atomic counters, Snapshot and Reset may be called from a (single) monitoring thread.
+     *
+     */
+    class AtomicBufferStats
+    {
+    private:
+        std::atomic<size_t> adds;
+        std::atomic<size_t> drops;
+        std::atomic<size_t> overflows;
+        std::atomic<size_t> removes;
+        std::atomic<size_t> peakSize;
+        // Owned by the monitoring thread.
+        BufferStatsSnapshot baseline;
+
+    public:
+        AtomicBufferStats() : adds(0), drops(0), overflows(0), removes(0), peakSize(0), baseline{0, 0, 0, 0, 0} {}
+
+        /**
+         * @brief Get the numbers collected since the construction or the last Reset.
+         * The counters are read one by one, so while the buffer is in use they may be a few operations apart.
+         *
+         * @return BufferStatsSnapshot The collected numbers.
+         */
+        BufferStatsSnapshot Snapshot() const
+        {
+            return BufferStatsSnapshot{
+                this->adds.load(std::memory_order_relaxed) - this->baseline.adds,
+                this->drops.load(std::memory_order_relaxed) - this->baseline.drops,
+                this->overflows.load(std::memory_order_relaxed) - this->baseline.overflows,
+                this->removes.load(std::memory_order_relaxed) - this->baseline.removes,
+                this->peakSize.load(std::memory_order_relaxed)};
+        }
+
+        /**
+         * @brief Start counting from zero again.
+         * The high-water mark starts again at the next add, so until then it can be lower than the current size.
+         *
+         */
+        void Reset()
+        {
+            this->baseline.adds = this->adds.load(std::memory_order_relaxed);
+            this->baseline.drops = this->drops.load(std::memory_order_relaxed);
+            this->baseline.overflows = this->overflows.load(std::memory_order_relaxed);
+            this->baseline.removes = this->removes.load(std::memory_order_relaxed);
+            // If this races with a add the add stores its (current) size, which is still a valid high-water mark.
+            this->peakSize.store(0, std::memory_order_relaxed);
+        }
+
+    protected:
+        void RecordAdd(size_t count, size_t size)
+        {
+            Increment(this->adds, count);
+            if (size > this->peakSize.load(std::memory_order_relaxed))
+            {
+                this->peakSize.store(size, std::memory_order_relaxed);
+            }
+        }
+
+        void RecordOverflow(size_t dropped)
+        {
+            Increment(this->drops, dropped);
+            Increment(this->overflows, 1);
+        }
+
+        void RecordRemove(size_t count)
+        {
+            Increment(this->removes, count);
+        }
+
+    private:
+        static void Increment(std::atomic<size_t> &counter, size_t count)
+        {
+            // Only the thread that uses the buffer writes, so no read-modify-write is needed.
+            counter.store(counter.load(std::memory_order_relaxed) + count, std::memory_order_relaxed);
+        }
+    };
+} // namespace libEmbedded
+
+#endif // LIBEMBEDDED_ATOMIC_BUFFER_STATS_H
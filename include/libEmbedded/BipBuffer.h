@@ -0,0 +1,315 @@
+/**
+ * @file BipBuffer.h
+ * @author Giel Willemsen
+ * @brief A byte ring of variable length records that are always contiguous (bipartite buffer).
+ * @version 0.1 2026-10-17 Initial version
+ * @version 0.2 2026-10-17 Commit without a outstanding reservation is a no-op.
+ * @version 0.3 2026-10-17 Add of a empty record does not pass its (possibly null) data to memcpy.
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * @details
+ * Every record is a TLength length header followed by the payload. A record never straddles the end of the storage:
+ * when it does not fit after the last record it is placed at the start of the storage instead (if the records in
+ * front have been consumed far enough), the space left at the end is skipped until the reader reaches it. So the
+ * storage is used as two regions, A with the oldest records and B at the start of the storage with the records added
+ * after the wrap. When A is fully consumed B becomes A.
+ * Producers get a Span to fill the payload in place (Reserve + Commit), consumers get a Span to parse it in place
+ * (Peek + Consume), nothing is copied. The payload has no alignment, parse structs with memcpy.
+ */
+#pragma once
+#ifndef LIBEMBEDDED_BIP_BUFFER_H
+#define LIBEMBEDDED_BIP_BUFFER_H
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include "libEmbedded/TypeTrait.h"
+#include "libEmbedded/Span.h"
+#include "libEmbedded/OverflowPolicy.h"
+
+namespace libEmbedded
+{
+    /**
+     * @brief Ring of variable length byte records, each record is one contiguous Span.
+     *
+     * @tparam TNumBytes The size of the storage in bytes, the headers included.
+     * @tparam TLength The unsigned type of the length header, it limits the size of a record.
+     * @tparam TOverflowPolicy What to do when a record does not fit: REJECT it or DROP_OLDEST records until it fits.
+     */
+    template <size_t TNumBytes, typename TLength = uint16_t, OverflowPolicy TOverflowPolicy = OverflowPolicy::REJECT>
+    class BipBuffer
+    {
+        static_assert(libEmbedded::is_integral<TLength>::value && static_cast<TLength>(-1) > 0, "TLength must be a unsigned integral type.");
+        static_assert(TNumBytes > sizeof(TLength), "The storage must be able to hold at least one header.");
+        static_assert(TOverflowPolicy != OverflowPolicy::BLOCK, "A BipBuffer is not thread safe so nothing can ever make room while blocking, use DROP_OLDEST or REJECT.");
+
+    public:
+        /**
+         * @brief The size of the header in front of every record.
+         *
+         */
+        static constexpr size_t kHeaderSize = sizeof(TLength);
+
+        /**
+         * @brief The largest payload that can ever fit.
+         *
+         */
+        static constexpr size_t kMaxRecordSize = TNumBytes - kHeaderSize < static_cast<TLength>(-1) ? TNumBytes - kHeaderSize : static_cast<TLength>(-1);
+
+    private:
+        uint8_t storage[TNumBytes];
+        // Region A holds the oldest records, region B (at the start of the storage) the ones added after the wrap.
+        size_t aStart;
+        size_t aEnd;
+        size_t bEnd;
+        bool bActive;
+        size_t count;
+        // The outstanding reservation, only valid while reserved is set (a reservation of 0 bytes is valid too).
+        bool reserved;
+        size_t reservedOffset;
+        size_t reservedLength;
+        bool reservedInB;
+
+    public:
+        /**
+         * @brief Construct a new empty buffer.
+         *
+         */
+        BipBuffer() : aStart(0), aEnd(0), bEnd(0), bActive(false), count(0), reserved(false), reservedOffset(0), reservedLength(0), reservedInB(false) {}
+
+        /**
+         * @brief Reserve room for a record of length bytes, to be filled in place and published with Commit.
+         * Only the last reservation can be committed.
+         *
+         * @param length The number of payload bytes needed.
+         * @return Span<uint8_t> The payload of the new record, with a nullptr begin when the record does not fit (or
+         * is larger than kMaxRecordSize).
+         */
+        Span<uint8_t> Reserve(size_t length);
+
+        /**
+         * @brief Publish the last reservation as a record. Does nothing when there is no outstanding reservation (the
+         * last Reserve failed or was already committed).
+         *
+         * @param length The number of bytes that were written, at most the reserved length (so a producer can
+         * reserve the maximum size and commit what it actually used).
+         */
+        void Commit(size_t length);
+
+        /**
+         * @brief Copy a record into the buffer.
+         *
+         * @param data The payload of the record.
+         * @param length The number of bytes in the payload.
+         * @return true If the record was added.
+         * @return false If the record does not fit (REJECT) or is larger than kMaxRecordSize.
+         */
+        bool Add(const uint8_t *data, size_t length);
+
+        /**
+         * @brief Retrieve the oldest record without copying it.
+         *
+         * @return Span<const uint8_t> The payload of the oldest record, with a nullptr begin when the buffer is empty.
+         */
+        Span<const uint8_t> Peek() const;
+
+        /**
+         * @brief Drop the oldest record, after it was read through Peek.
+         *
+         */
+        void Consume();
+
+        /**
+         * @brief Remove all records.
+         *
+         */
+        void Clear();
+
+        /**
+         * @brief Returns the number of records in the buffer.
+         *
+         * @return size_t The number of records.
+         */
+        size_t Count() const;
+
+        /**
+         * @brief Returns the number of bytes the records take, headers included.
+         *
+         * @return size_t The number of bytes in use.
+         */
+        size_t BytesUsed() const;
+
+        /**
+         * @brief Returns the size of the storage.
+         *
+         * @return size_t The size of the storage in bytes.
+         */
+        size_t Capacity() const;
+
+    private:
+        bool FindSpace(size_t total, size_t &offset, bool &inB) const;
+
+        TLength ReadLength(size_t offset) const;
+    };
+
+    template <size_t TNumBytes, typename TLength, OverflowPolicy TOverflowPolicy>
+    Span<uint8_t> BipBuffer<TNumBytes, TLength, TOverflowPolicy>::Reserve(size_t length)
+    {
+        this->reserved = false;
+        if (length > kMaxRecordSize)
+        {
+            return Span<uint8_t>(nullptr, nullptr);
+        }
+        const size_t total = kHeaderSize + length;
+        size_t offset = 0;
+        bool inB = false;
+        while (!this->FindSpace(total, offset, inB))
+        {
+            if (TOverflowPolicy == OverflowPolicy::REJECT)
+            {
+                return Span<uint8_t>(nullptr, nullptr);
+            }
+            // Always ends up fitting, a empty buffer has room for kMaxRecordSize.
+            this->Consume();
+        }
+        this->reserved = true;
+        this->reservedOffset = offset;
+        this->reservedLength = length;
+        this->reservedInB = inB;
+        return Span<uint8_t>(&this->storage[offset + kHeaderSize], length);
+    }
+
+    template <size_t TNumBytes, typename TLength, OverflowPolicy TOverflowPolicy>
+    void BipBuffer<TNumBytes, TLength, TOverflowPolicy>::Commit(size_t length)
+    {
+        if (!this->reserved)
+        {
+            return;
+        }
+        if (length > this->reservedLength)
+        {
+            length = this->reservedLength;
+        }
+        const TLength header = static_cast<TLength>(length);
+        memcpy(&this->storage[this->reservedOffset], &header, kHeaderSize);
+        const size_t end = this->reservedOffset + kHeaderSize + length;
+        if (this->reservedInB)
+        {
+            this->bEnd = end;
+            this->bActive = true;
+        }
+        else
+        {
+            this->aEnd = end;
+        }
+        this->count++;
+        this->reserved = false;
+    }
+
+    template <size_t TNumBytes, typename TLength, OverflowPolicy TOverflowPolicy>
+    bool BipBuffer<TNumBytes, TLength, TOverflowPolicy>::Add(const uint8_t *data, size_t length)
+    {
+        Span<uint8_t> record = this->Reserve(length);
+        if (record.begin() == nullptr)
+        {
+            return false;
+        }
+        if (length > 0)
+        {
+            memcpy(record.begin(), data, length);
+        }
+        this->Commit(length);
+        return true;
+    }
+
+    template <size_t TNumBytes, typename TLength, OverflowPolicy TOverflowPolicy>
+    Span<const uint8_t> BipBuffer<TNumBytes, TLength, TOverflowPolicy>::Peek() const
+    {
+        if (this->count == 0)
+        {
+            return Span<const uint8_t>(nullptr, nullptr);
+        }
+        return Span<const uint8_t>(&this->storage[this->aStart + kHeaderSize], static_cast<size_t>(this->ReadLength(this->aStart)));
+    }
+
+    template <size_t TNumBytes, typename TLength, OverflowPolicy TOverflowPolicy>
+    void BipBuffer<TNumBytes, TLength, TOverflowPolicy>::Consume()
+    {
+        if (this->count == 0)
+        {
+            return;
+        }
+        this->aStart += kHeaderSize + this->ReadLength(this->aStart);
+        this->count--;
+        if (this->aStart == this->aEnd)
+        {
+            // Region A is consumed, continue with region B (if any) at the start of the storage.
+            this->aStart = 0;
+            this->aEnd = this->bActive ? this->bEnd : 0;
+            this->bEnd = 0;
+            this->bActive = false;
+        }
+    }
+
+    template <size_t TNumBytes, typename TLength, OverflowPolicy TOverflowPolicy>
+    void BipBuffer<TNumBytes, TLength, TOverflowPolicy>::Clear()
+    {
+        this->aStart = 0;
+        this->aEnd = 0;
+        this->bEnd = 0;
+        this->bActive = false;
+        this->count = 0;
+        this->reserved = false;
+    }
+
+    template <size_t TNumBytes, typename TLength, OverflowPolicy TOverflowPolicy>
+    size_t BipBuffer<TNumBytes, TLength, TOverflowPolicy>::Count() const
+    {
+        return this->count;
+    }
+
+    template <size_t TNumBytes, typename TLength, OverflowPolicy TOverflowPolicy>
+    size_t BipBuffer<TNumBytes, TLength, TOverflowPolicy>::BytesUsed() const
+    {
+        return this->aEnd - this->aStart + (this->bActive ? this->bEnd : 0);
+    }
+
+    template <size_t TNumBytes, typename TLength, OverflowPolicy TOverflowPolicy>
+    size_t BipBuffer<TNumBytes, TLength, TOverflowPolicy>::Capacity() const
+    {
+        return TNumBytes;
+    }
+
+    template <size_t TNumBytes, typename TLength, OverflowPolicy TOverflowPolicy>
+    bool BipBuffer<TNumBytes, TLength, TOverflowPolicy>::FindSpace(size_t total, size_t &offset, bool &inB) const
+    {
+        if (this->bActive)
+        {
+            // Region B grows towards the start of region A.
+            offset = this->bEnd;
+            inB = true;
+            return this->aStart - this->bEnd >= total;
+        }
+        if (TNumBytes - this->aEnd >= total)
+        {
+            offset = this->aEnd;
+            inB = false;
+            return true;
+        }
+        // Wrap, the rest of the storage after region A is skipped.
+        offset = 0;
+        inB = true;
+        return this->aStart >= total;
+    }
+
+    template <size_t TNumBytes, typename TLength, OverflowPolicy TOverflowPolicy>
+    TLength BipBuffer<TNumBytes, TLength, TOverflowPolicy>::ReadLength(size_t offset) const
+    {
+        TLength length;
+        memcpy(&length, &this->storage[offset], kHeaderSize);
+        return length;
+    }
+} // namespace libEmbedded
+
+#endif // LIBEMBEDDED_BIP_BUFFER_H
@@ -1,10 +1,22 @@
 /**
  * @file Buffer.h
  * @author Giel Willemsen
- * @brief Implement a buffer of a static size that drops elements the oldest elements once space runs out.
+ * @brief Implement a buffer of a static size that drops elements the oldest elements once space runs out (or rejects the new ones).
  * @version 0.1 2022-02-20 Initial version
  * @version 0.2 2022-06-16 Resolved a issue where the Remove method had a wrong memory offset in the buffer and would also reset the elementsUsed counter.
- * @date 2022-06-16
+ * @version 0.3 2026-10-17 Buffer is now a ring (head index + count) so Add, AddRange and Remove no longer shift the contents, iterators are wrap-aware.
+ * @version 0.4 2026-10-17 Bulk memcpy/memcmp for trivially copyable types and no destructor calls for trivially destructible types.
+ * @version 0.5 2026-10-17 Move constructor/assignment, Add(T&&), Emplace and AddRange over iterators (for move iterators).
+ * @version 0.6 2026-10-17 Zero-copy Reserve/Commit for producers and Peek/Consume for consumers.
+ * @version 0.7 2026-10-17 Workspace is aligned for T, or to the given TAlignment (for example a cache line for aligned SIMD loads).
+ * @version 0.8 2026-10-17 Compile time OverflowPolicy, either drop the oldest elements (as before) or reject the new ones.
+ * @version 0.9 2026-10-17 Optional stats policy counting adds, drops, removes and the high-water mark.
+ * @version 0.10 2026-10-17 Indices are wrapped with a mask instead of a compare when TNumElements is a power of two.
+ * @version 0.11 2026-10-17 BufferIterator is random access (difference, [], relational operators) and exposes its contiguous segments.
+ * @version 0.12 2026-10-17 BufferIterator is tagged as a random access iterator.
+ * @version 0.13 2026-10-17 Field by field raw copy for the SeqlockBuffer snapshots.
+ * @version 0.14 2026-10-17 Add and Emplace on a full DROP_OLDEST buffer may take their value from the oldest element.
+ * @date 2026-10-17
  *
  * @copyright Copyright (c) 2022
  *
@@ -13,20 +25,291 @@
 #define LIBEMBEDDED_BUFFER_H
 
 #include <stddef.h>
+#include <string.h>
+#include "libEmbedded/TypeTrait.h"
+#include "libEmbedded/Helpers.h"
+#include "libEmbedded/Span.h"
+#include "libEmbedded/OverflowPolicy.h"
+#include "libEmbedded/BufferStats.h"
 
 namespace libEmbedded
 {
+    /**
+     * @brief A region of a Buffer split in the part up to the end of the workspace and the part that wrapped to the start.
+     * The second span is empty when the region doesn't wrap.
+     *
+     * @tparam T The type of the element (const T for a readonly region).
+     */
+    template <typename T>
+    struct BufferSegments
+    {
+        /**
+         * @brief The elements up to the end of the workspace.
+         *
+         */
+        Span<T> first;
+
+        /**
+         * @brief The elements that continue at the start of the workspace.
+         *
+         */
+        Span<T> second;
+
+        /**
+         * @brief The total number of elements in both segments.
+         *
+         * @return size_t The number of elements.
+         */
+        size_t Size() const
+        {
+            return static_cast<size_t>(first.cend() - first.cbegin()) + static_cast<size_t>(second.cend() - second.cbegin());
+        }
+    };
+
+    /**
+     * @brief Wraps a index in a ring of TNumElements slots that went past the end back to the start.
+     * The index may be at most 2 * TNumElements - 1.
+     *
+     * @tparam TNumElements The number of slots in the ring.
+     */
+    template <size_t TNumElements, typename TEnable = void>
+    struct BufferIndex
+    {
+        static constexpr size_t Wrap(size_t index)
+        {
+            return index >= TNumElements ? index - TNumElements : index;
+        }
+    };
+
+    /**
+     * @brief Wraps a index in a ring with a power of two number of slots, a single AND without a branch.
+     * Any index can be wrapped, so also free-running counters.
+     *
+     * @tparam TNumElements The number of slots in the ring.
+     */
+    template <size_t TNumElements>
+    struct BufferIndex<TNumElements, typename libEmbedded::enable_if<libEmbedded::IsPowerOfTwo(TNumElements)>::type>
+    {
+        static constexpr size_t Wrap(size_t index)
+        {
+            return index & (TNumElements - 1);
+        }
+    };
+
+    /**
+     * @brief Iterator over the elements of a Buffer that follows the elements around the wrap point of the ring.
+     * Random access: moving, the difference, [] and comparing are all O(1). Iterators of different buffers can not be
+     * compared (except for equality).
+     *
+     * @tparam T The type of the element (const T for a readonly iterator).
+     * @tparam TNumElements The number of elements in the ring that is iterated.
+     */
     template <typename T, size_t TNumElements>
-    class Buffer
+    class BufferIterator
+    {
+    public:
+        typedef typename libEmbedded::remove_const<T>::type value_type;
+        typedef ptrdiff_t difference_type;
+        typedef T *pointer;
+        typedef T &reference;
+        typedef random_access_iterator_tag iterator_category;
+
+    private:
+        T *storage;
+        // Position from the start of the storage, not yet wrapped (so can be up to 2 * TNumElements).
+        size_t position;
+
+    public:
+        /**
+         * @brief Construct a new iterator at the given (unwrapped) position in the storage.
+         *
+         * @param storage The start of the ring storage.
+         * @param position The position in the storage, may be beyond the end of the storage (it is wrapped when dereferenced).
+         */
+        constexpr BufferIterator(T *storage, size_t position) : storage(storage), position(position) {}
+
+        /**
+         * @brief Convert a modifiable iterator into a readonly one.
+         *
+         * @return BufferIterator<const T, TNumElements> The readonly iterator at the same position.
+         */
+        operator BufferIterator<const T, TNumElements>() const
+        {
+            return BufferIterator<const T, TNumElements>(this->storage, this->position);
+        }
+
+        T &operator*() const
+        {
+            return this->storage[BufferIndex<TNumElements>::Wrap(this->position)];
+        }
+
+        T *operator->() const
+        {
+            return &(**this);
+        }
+
+        BufferIterator<T, TNumElements> &operator++()
+        {
+            ++this->position;
+            return *this;
+        }
+
+        BufferIterator<T, TNumElements> operator++(int)
+        {
+            BufferIterator<T, TNumElements> old = *this;
+            ++this->position;
+            return old;
+        }
+
+        BufferIterator<T, TNumElements> &operator--()
+        {
+            --this->position;
+            return *this;
+        }
+
+        BufferIterator<T, TNumElements> operator--(int)
+        {
+            BufferIterator<T, TNumElements> old = *this;
+            --this->position;
+            return old;
+        }
+
+        BufferIterator<T, TNumElements> &operator+=(size_t n)
+        {
+            this->position += n;
+            return *this;
+        }
+
+        BufferIterator<T, TNumElements> &operator-=(size_t n)
+        {
+            this->position -= n;
+            return *this;
+        }
+
+        BufferIterator<T, TNumElements> operator+(size_t n) const
+        {
+            return BufferIterator<T, TNumElements>(this->storage, this->position + n);
+        }
+
+        BufferIterator<T, TNumElements> operator-(size_t n) const
+        {
+            return BufferIterator<T, TNumElements>(this->storage, this->position - n);
+        }
+
+        friend BufferIterator<T, TNumElements> operator+(size_t n, const BufferIterator<T, TNumElements> &it)
+        {
+            return it + n;
+        }
+
+        /**
+         * @brief The number of elements from the other iterator to this one.
+         *
+         * @param other A iterator of the same buffer.
+         * @return ptrdiff_t The number of elements, negative if other is after this iterator.
+         */
+        ptrdiff_t operator-(const BufferIterator<T, TNumElements> &other) const
+        {
+            return static_cast<ptrdiff_t>(this->position - other.position);
+        }
+
+        T &operator[](ptrdiff_t n) const
+        {
+            return this->storage[BufferIndex<TNumElements>::Wrap(this->position + static_cast<size_t>(n))];
+        }
+
+        bool operator==(const BufferIterator<T, TNumElements> &other) const
+        {
+            return this->storage == other.storage && this->position == other.position;
+        }
+
+        bool operator!=(const BufferIterator<T, TNumElements> &other) const
+        {
+            return this->storage != other.storage || this->position != other.position;
+        }
+
+        bool operator<(const BufferIterator<T, TNumElements> &other) const
+        {
+            return this->position < other.position;
+        }
+
+        bool operator>(const BufferIterator<T, TNumElements> &other) const
+        {
+            return this->position > other.position;
+        }
+
+        bool operator<=(const BufferIterator<T, TNumElements> &other) const
+        {
+            return this->position <= other.position;
+        }
+
+        bool operator>=(const BufferIterator<T, TNumElements> &other) const
+        {
+            return this->position >= other.position;
+        }
+
+        /**
+         * @brief Returns the number of elements from this iterator up to the end of the storage, the elements that can
+         * be reached through a plain pointer from &*it without wrapping.
+         *
+         * @return size_t The number of contiguous elements, at least 1.
+         */
+        size_t ContiguousLength() const
+        {
+            return TNumElements - BufferIndex<TNumElements>::Wrap(this->position);
+        }
+
+        /**
+         * @brief Split the range from this iterator up to end in the (at most) two contiguous parts of the storage,
+         * so a algorithm can run over plain pointers without checking for the wrap at every element.
+         *
+         * @param end The iterator one passed the last element of the range, not before this iterator.
+         * @return BufferSegments<T> The range, the second segment is empty when the range does not wrap.
+         */
+        BufferSegments<T> SegmentsTo(const BufferIterator<T, TNumElements> &end) const
+        {
+            return this->SplitSegments(static_cast<size_t>(end - *this), this->ContiguousLength());
+        }
+
+    private:
+        BufferSegments<T> SplitSegments(size_t count, size_t contiguous) const
+        {
+            return count <= contiguous ? BufferSegments<T>{Span<T>(&**this, count), Span<T>(this->storage, this->storage)}
+                                       : BufferSegments<T>{Span<T>(&**this, contiguous), Span<T>(this->storage, count - contiguous)};
+        }
+    };
+
+    /**
+     * @brief Buffer of a static size that drops the oldest elements once space runs out.
+     *
+     * @tparam T The type of the element in the buffer.
+     * @tparam TNumElements The maximum number of elements in the buffer.
+     * @tparam TAlignment The alignment of the storage, at least alignof(T). Use kCacheLineSize (or 32 for AVX) to allow aligned
+     * vector loads on the first element of a empty or just Peek'ed buffer.
+     * @tparam TOverflowPolicy What to do when adding to a full buffer: DROP_OLDEST or REJECT (BLOCK is only for the concurrent queues).
+     * @tparam TStats The stats policy: NoBufferStats (no overhead), BufferStats or AtomicBufferStats (to read the stats from an other thread).
+     */
+    template <typename T, size_t TNumElements, size_t TAlignment = alignof(T), OverflowPolicy TOverflowPolicy = OverflowPolicy::DROP_OLDEST, typename TStats = NoBufferStats>
+    class Buffer : private TStats
     {
+        static_assert(TAlignment >= alignof(T), "TAlignment must be at least the alignment of T.");
+        static_assert((TAlignment & (TAlignment - 1)) == 0, "TAlignment must be a power of two.");
+        static_assert(TOverflowPolicy != OverflowPolicy::BLOCK, "A Buffer is not thread safe so nothing can ever make room while blocking, use DROP_OLDEST or REJECT.");
+
+        template <typename, size_t, size_t, OverflowPolicy, typename>
+        friend class Buffer;
+        template <typename, size_t>
+        friend class SeqlockBuffer;
+
     public:
-        typedef T *iterator;
-        typedef const T *const_iterator;
+        typedef BufferIterator<T, TNumElements> iterator;
+        typedef BufferIterator<const T, TNumElements> const_iterator;
 
     private:
     public:
     private:
-        char workspace[TNumElements * sizeof(T)];
+        typename libEmbedded::aligned_storage<TNumElements * sizeof(T), TAlignment>::type workspace;
+        // Index in the workspace of the oldest element.
+        size_t head;
         size_t elementsUsed;
 
     public:
@@ -34,22 +317,29 @@ namespace libEmbedded
          * @brief Construct a new empty rotating buffer.
          *
          */
-        constexpr Buffer() : workspace{0}, elementsUsed(0) {}
+        constexpr Buffer() : TStats(), workspace(), head(0), elementsUsed(0) {}
 
         /**
          * @brief Copies the other buffer into this instance.
          *
          * @param other The buffer to copy from.
          */
-        Buffer(const Buffer<T, TNumElements> &other);
+        Buffer(const Buffer<T, TNumElements, TAlignment, TOverflowPolicy, TStats> &other);
 
         /**
          * @brief Copies the other buffer into this instance.
          *
          * @param other The buffer to copy from.
          */
-        template <size_t TNumOtherElements>
-        Buffer(const Buffer<T, TNumOtherElements> &other);
+        template <size_t TNumOtherElements, size_t TOtherAlignment, OverflowPolicy TOtherOverflowPolicy, typename TOtherStats>
+        Buffer(const Buffer<T, TNumOtherElements, TOtherAlignment, TOtherOverflowPolicy, TOtherStats> &other);
+
+        /**
+         * @brief Moves the elements of the other buffer into this instance. The other buffer is empty afterwards.
+         *
+         * @param other The buffer to move the elements from.
+         */
+        Buffer(Buffer<T, TNumElements, TAlignment, TOverflowPolicy, TStats> &&other);
 
         /**
          * @brief Destroy the buffer.
@@ -119,20 +409,87 @@ namespace libEmbedded
         void Remove(size_t count);
 
         /**
-         * @brief Adds the given element to the back of the buffer. Poping at the beginning if necessary.
+         * @brief Adds the given element to the back of the buffer. Poping at the beginning if necessary (DROP_OLDEST).
          *
          * @param element The element to add to the buffer.
+         * @return true If the element was added.
+         * @return false If the buffer was full and the policy is REJECT.
+         */
+        bool Add(const T &element);
+
+        /**
+         * @brief Moves the given element to the back of the buffer. Poping at the beginning if necessary (DROP_OLDEST).
+         *
+         * @param element The element to move into the buffer.
+         * @return true If the element was added.
+         * @return false If the buffer was full and the policy is REJECT.
          */
-        void Add(const T &element);
+        bool Add(T &&element);
 
         /**
-         * @brief Adds the given elements to the back of the buffer. Poping at the beginning if necessary.
+         * @brief Constructs a new element in place at the back of the buffer. Poping at the beginning if necessary (DROP_OLDEST).
+         *
+         * @tparam TArgs The types of the constructor arguments.
+         * @param args The arguments passed to the constructor of T.
+         * @return T* The newly constructed element, nullptr if the buffer was full and the policy is REJECT.
+         */
+        template <typename... TArgs>
+        T *Emplace(TArgs &&...args);
+
+        /**
+         * @brief Adds the given elements to the back of the buffer. Poping at the beginning if necessary (DROP_OLDEST).
          * If elementCount is more than fit in the buffer only the last items the given elements are actually copied and preserved.
+         * With REJECT only the first elements that fit in the free space are added.
          *
          * @param elements The elements to add to the buffer.
          * @param elementCount The number of elements to add to the buffer.
+         * @return size_t The number of elements that ended up in the buffer.
          */
-        void AddRange(const T *elements, size_t elememtCount);
+        size_t AddRange(const T *elements, size_t elememtCount);
+
+        /**
+         * @brief Adds the elements between begin and end to the back of the buffer. Poping at the beginning if necessary (DROP_OLDEST).
+         * Each element is constructed from *it, so with a move iterator the elements are moved instead of copied.
+         * With REJECT it stops at the first element that doesn't fit.
+         *
+         * @tparam TIterator The type of the iterator.
+         * @param begin The first element to add.
+         * @param end The iterator one passed the last element to add.
+         * @return size_t The number of elements added.
+         */
+        template <typename TIterator>
+        size_t AddRange(TIterator begin, TIterator end);
+
+        /**
+         * @brief Hand out count slots after the last element to write into directly (for example with read/recv/readv or DMA),
+         * dropping the oldest elements if there isn't enough free space (DROP_OLDEST). Publish the written elements with Commit.
+         * Only for trivially copyable T since the slots don't hold a constructed T.
+         *
+         * @param count The number of slots needed, clamped to the Capacity (and with REJECT to the free space).
+         * @return BufferSegments<T> The slots, two segments if the free space wraps around the end of the workspace.
+         */
+        BufferSegments<T> Reserve(size_t count);
+
+        /**
+         * @brief Publish the first count slots handed out by Reserve as elements of the buffer.
+         *
+         * @param count The number of slots that were written, clamped to the free space.
+         */
+        void Commit(size_t count);
+
+        /**
+         * @brief Retrieve all elements in the buffer without copying them.
+         *
+         * @return BufferSegments<const T> The elements, two segments if they wrap around the end of the workspace.
+         */
+        BufferSegments<const T> Peek() const;
+
+        /**
+         * @brief Drop the given number of elements from the front, after they were read through Peek.
+         *
+         * @param count The number of elements to drop.
+         */
+        void Consume(size_t count);
 
         /**
          * @brief Returns the number of elements that are present in the buffer.
@@ -148,7 +505,30 @@ namespace libEmbedded
          */
         size_t Capacity() const;
 
-        Buffer<T, TNumElements> &operator=(const Buffer<T, TNumElements> &other);
+        /**
+         * @brief Returns the stats policy to take a Snapshot of (or Reset) the collected numbers.
+         * A copied or moved buffer starts with fresh stats, they belong to the instance and not to the elements.
+         *
+         * @return TStats& The stats of this buffer.
+         */
+        TStats &GetStats();
+
+        /**
+         * @brief Returns the stats policy to take a Snapshot of the collected numbers.
+         *
+         * @return const TStats& The stats of this buffer.
+         */
+        const TStats &GetStats() const;
+
+        Buffer<T, TNumElements, TAlignment, TOverflowPolicy, TStats> &operator=(const Buffer<T, TNumElements, TAlignment, TOverflowPolicy, TStats> &other);
+
+        /**
+         * @brief Moves the elements of the other buffer into this one, dropping the current elements. The other buffer is empty afterwards.
+         *
+         * @param other The buffer to move the elements from.
+         * @return Buffer<T, TNumElements, TAlignment, TOverflowPolicy, TStats>& This buffer.
+         */
+        Buffer<T, TNumElements, TAlignment, TOverflowPolicy, TStats> &operator=(Buffer<T, TNumElements, TAlignment, TOverflowPolicy, TStats> &&other);
 
         /**
          * @brief Retrieve the element at the given index of the buffer.
@@ -186,240 +566,547 @@ namespace libEmbedded
          */
         const T &GetItem(size_t index) const;
 
-        template <size_t TOtherNumElements>
-        bool operator==(const Buffer<T, TOtherNumElements> &other) const;
+        template <size_t TOtherNumElements, size_t TOtherAlignment, OverflowPolicy TOtherOverflowPolicy, typename TOtherStats>
+        bool operator==(const Buffer<T, TOtherNumElements, TOtherAlignment, TOtherOverflowPolicy, TOtherStats> &other) const;
 
-        template <size_t TOtherNumElements>
-        bool operator!=(const Buffer<T, TOtherNumElements> &other) const;
+        template <size_t TOtherNumElements, size_t TOtherAlignment, OverflowPolicy TOtherOverflowPolicy, typename TOtherStats>
+        bool operator!=(const Buffer<T, TOtherNumElements, TOtherAlignment, TOtherOverflowPolicy, TOtherStats> &other) const;
 
     private:
-        iterator GetIndexPointer(size_t index);
+        /**
+         * @brief Copy the head, the count and the whole workspace of other without constructing or destructing
+         * elements (the SeqlockBuffer snapshot, which may race with the writer). Only for trivially copyable T.
+         * The whole workspace is copied so a torn head or count can never make the copy go out of bounds.
+         *
+         * @param other The buffer to copy.
+         */
+        void RawCopyFrom(const Buffer<T, TNumElements, TAlignment, TOverflowPolicy, TStats> &other);
 
-        const_iterator GetConstIndexPointer(size_t index) const;
-    };
+        /**
+         * @brief Wrap a index that went past the end of the workspace back to the start.
+         * Only works for index < 2 * TNumElements, avoiding a division on every access (a mask for power of two sizes).
+         *
+         * @param index The index to wrap.
+         * @return size_t The index inside the workspace.
+         */
+        static constexpr size_t Wrap(size_t index)
+        {
+            return BufferIndex<TNumElements>::Wrap(index);
+        }
 
-    template <typename T, size_t TNumElements>
-    Buffer<T, TNumElements>::Buffer(const Buffer<T, TNumElements> &other)
-    {
-        for (size_t i = 0; i < other.elementsUsed; i++)
+        T *GetStorage();
+
+        const T *GetConstStorage() const;
+
+        T *GetIndexPointer(size_t index);
+
+        const T *GetConstIndexPointer(size_t index) const;
+
+        /**
+         * @brief The number of elements, starting at index, that are next to each other in the workspace.
+         *
+         * @param index The index of the first element.
+         * @return size_t The number of elements until either the end of the buffer or the end of the workspace.
+         */
+        size_t ContiguousFrom(size_t index) const
         {
-            T *memory = GetIndexPointer(i);
-            new (memory) T(other.GetItem(i));
+            const size_t untilEnd = TNumElements - Wrap(this->head + index);
+            const size_t left = this->elementsUsed - index;
+            return left < untilEnd ? left : untilEnd;
         }
-        this->elementsUsed = other.elementsUsed;
+
+        /**
+         * @brief Append the elements of the other buffer, there must be enough space left for all of them.
+         *
+         * @param other The buffer to copy the elements from.
+         */
+        template <size_t TOtherNumElements, size_t TOtherAlignment, OverflowPolicy TOtherOverflowPolicy, typename TOtherStats>
+        void AppendBuffer(const Buffer<T, TOtherNumElements, TOtherAlignment, TOtherOverflowPolicy, TOtherStats> &other)
+        {
+            size_t index = 0;
+            while (index < other.elementsUsed)
+            {
+                const size_t count = other.ContiguousFrom(index);
+                this->ConstructBack(other.GetConstIndexPointer(index), count);
+                index += count;
+            }
+        }
+
+        /**
+         * @brief Move the elements of the other buffer to the end of this one and empty the other buffer.
+         *
+         * @param other The buffer to take the elements from.
+         */
+        void TakeBuffer(Buffer<T, TNumElements, TAlignment, TOverflowPolicy, TStats> &other)
+        {
+            size_t index = 0;
+            while (index < other.elementsUsed)
+            {
+                const size_t count = other.ContiguousFrom(index);
+                this->MoveConstructBack(other.GetIndexPointer(index), count);
+                index += count;
+            }
+            other.DropFront(other.elementsUsed);
+        }
+
+        /**
+         * @brief Destroy the first count elements (there must be at least count) without counting them as removed.
+         *
+         * @param count The number of elements to drop.
+         */
+        void DropFront(size_t count)
+        {
+            this->DestroyFront(count);
+            this->head = Wrap(this->head + count);
+            this->elementsUsed -= count;
+            if (this->elementsUsed == 0)
+            {
+                // Start at the beginning again so a buffer that is never filled up never wraps.
+                this->head = 0;
+            }
+        }
+
+        /**
+         * @brief Make room for count new elements and record the elements that are lost because the buffer is full.
+         *
+         * @param count The number of new elements.
+         * @return size_t The number of new elements that can be added now.
+         */
+        size_t Admit(size_t count)
+        {
+            const size_t usedBefore = this->elementsUsed;
+            const size_t admitted = this->MakeRoom(count);
+            // Old elements dropped to make room plus the new elements that don't fit.
+            const size_t dropped = (usedBefore - this->elementsUsed) + (count - admitted);
+            if (dropped > 0)
+            {
+                this->RecordOverflow(dropped);
+            }
+            return admitted;
+        }
+
+        /**
+         * @brief Make sure there are free slots for count new elements, as far as the overflow policy allows.
+         *
+         * @param count The number of new elements.
+         * @return size_t The number of elements that can be added now.
+         */
+        template <OverflowPolicy TPolicy = TOverflowPolicy>
+        typename libEmbedded::enable_if<TPolicy == OverflowPolicy::DROP_OLDEST, size_t>::type MakeRoom(size_t count)
+        {
+            const size_t wanted = count > TNumElements ? TNumElements : count;
+            const size_t freeCount = TNumElements - this->elementsUsed;
+            if (wanted > freeCount)
+            {
+                this->DropFront(wanted - freeCount);
+            }
+            return wanted;
+        }
+
+        template <OverflowPolicy TPolicy = TOverflowPolicy>
+        typename libEmbedded::enable_if<TPolicy == OverflowPolicy::REJECT, size_t>::type MakeRoom(size_t count)
+        {
+            const size_t freeCount = TNumElements - this->elementsUsed;
+            return count > freeCount ? freeCount : count;
+        }
+
+        /**
+         * @brief Construct a new element at the back, after making room for it.
+         *
+         * @param args The arguments passed to the constructor of T.
+         * @return T* The newly constructed element, nullptr if there was no room.
+         */
+        template <typename... TArgs>
+        T *EmplaceBack(libEmbedded::false_type, TArgs &&...args)
+        {
+            if (this->Admit(1) == 0)
+            {
+                return nullptr;
+            }
+            T *location = new (this->GetIndexPointer(this->Size())) T(libEmbedded::forward<TArgs>(args)...);
+            this->elementsUsed++;
+            this->RecordAdd(1, this->elementsUsed);
+            return location;
+        }
+
+        /**
+         * @brief Construct a new element at the back of a DROP_OLDEST buffer with a non trivial destructor.
+         * On a full buffer the new element goes into the slot of the oldest one, which is destroyed first. The
+         * arguments may refer to that element (buffer.Add(buffer[0])), so the new element is built before that.
+         *
+         * @param args The arguments passed to the constructor of T.
+         * @return T* The newly constructed element.
+         */
+        template <typename... TArgs>
+        T *EmplaceBack(libEmbedded::true_type, TArgs &&...args)
+        {
+            if (this->elementsUsed == TNumElements)
+            {
+                T element(libEmbedded::forward<TArgs>(args)...);
+                return this->EmplaceBack(libEmbedded::false_type(), libEmbedded::move(element));
+            }
+            return this->EmplaceBack(libEmbedded::false_type(), libEmbedded::forward<TArgs>(args)...);
+        }
+
+        template <typename C = T>
+        typename libEmbedded::enable_if<libEmbedded::is_trivially_copyable<C>::value, void>::type MoveConstructBack(T *elements, size_t count)
+        {
+            this->ConstructBack(elements, count);
+        }
+
+        template <typename C = T>
+        typename libEmbedded::enable_if<!libEmbedded::is_trivially_copyable<C>::value, void>::type MoveConstructBack(T *elements, size_t count)
+        {
+            for (size_t i = 0; i < count; i++)
+            {
+                new (this->GetIndexPointer(this->elementsUsed)) T(libEmbedded::move(elements[i]));
+                this->elementsUsed++;
+            }
+        }
+
+        template <typename C = T>
+        typename libEmbedded::enable_if<libEmbedded::is_trivially_copyable<C>::value, void>::type ConstructBack(const T *elements, size_t count)
+        {
+            // At most two copies, one until the end of the workspace and one for the part that wraps to the start.
+            const size_t first = TNumElements - Wrap(this->head + this->elementsUsed);
+            const size_t firstCount = count < first ? count : first;
+            memcpy(this->GetIndexPointer(this->elementsUsed), elements, firstCount * sizeof(T));
+            memcpy(this->GetStorage(), elements + firstCount, (count - firstCount) * sizeof(T));
+            this->elementsUsed += count;
+        }
+
+        template <typename C = T>
+        typename libEmbedded::enable_if<!libEmbedded::is_trivially_copyable<C>::value, void>::type ConstructBack(const T *elements, size_t count)
+        {
+            for (size_t i = 0; i < count; i++)
+            {
+                new (this->GetIndexPointer(this->elementsUsed)) T(elements[i]);
+                this->elementsUsed++;
+            }
+        }
+
+        template <typename C = T>
+        typename libEmbedded::enable_if<libEmbedded::is_trivially_destructible<C>::value, void>::type DestroyFront(size_t)
+        {
+        }
+
+        template <typename C = T>
+        typename libEmbedded::enable_if<!libEmbedded::is_trivially_destructible<C>::value, void>::type DestroyFront(size_t count)
+        {
+            for (size_t i = 0; i < count; i++)
+            {
+                this->GetIndexPointer(i)->~T();
+            }
+        }
+
+        // Only types without padding or special values (like -0.0 and NaN for floats) can be compared byte for byte.
+        template <typename C = T>
+        static typename libEmbedded::enable_if<libEmbedded::is_integral<C>::value || libEmbedded::is_pointer<C>::value, bool>::type EqualElements(const T *a, const T *b, size_t count)
+        {
+            return memcmp(a, b, count * sizeof(T)) == 0;
+        }
+
+        template <typename C = T>
+        static typename libEmbedded::enable_if<!(libEmbedded::is_integral<C>::value || libEmbedded::is_pointer<C>::value), bool>::type EqualElements(const T *a, const T *b, size_t count)
+        {
+            for (size_t i = 0; i < count; i++)
+            {
+                if (a[i] != b[i])
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+    };
+
+    template <typename T, size_t TNumElements, size_t TAlignment, OverflowPolicy TOverflowPolicy, typename TStats>
+    Buffer<T, TNumElements, TAlignment, TOverflowPolicy, TStats>::Buffer(const Buffer<T, TNumElements, TAlignment, TOverflowPolicy, TStats> &other) : TStats(), head(0), elementsUsed(0)
+    {
+        this->AppendBuffer(other);
     }
 
-    template <typename T, size_t TNumElements>
-    template <size_t TNumOtherElements>
-    Buffer<T, TNumElements>::Buffer(const Buffer<T, TNumOtherElements> &other)
+    template <typename T, size_t TNumElements, size_t TAlignment, OverflowPolicy TOverflowPolicy, typename TStats>
+    template <size_t TNumOtherElements, size_t TOtherAlignment, OverflowPolicy TOtherOverflowPolicy, typename TOtherStats>
+    Buffer<T, TNumElements, TAlignment, TOverflowPolicy, TStats>::Buffer(const Buffer<T, TNumOtherElements, TOtherAlignment, TOtherOverflowPolicy, TOtherStats> &other) : TStats(), head(0), elementsUsed(0)
     {
         static_assert(TNumOtherElements <= TNumElements, "TNumOtherElements must be of equal size or less than the targets buffer TNumElements.");
-        // Size must be used because of TNumOtherElements we run into Private/Public issues with template instantation.
-        for (size_t i = 0; i < other.Size(); i++)
-        {
-            T *memory = GetIndexPointer(i);
-            new (memory) T(other.GetItem(i));
-        }
-        this->elementsUsed = other.Size();
+        this->AppendBuffer(other);
     }
 
-    template <typename T, size_t TNumElements>
-    Buffer<T, TNumElements>::~Buffer()
+    template <typename T, size_t TNumElements, size_t TAlignment, OverflowPolicy TOverflowPolicy, typename TStats>
+    Buffer<T, TNumElements, TAlignment, TOverflowPolicy, TStats>::Buffer(Buffer<T, TNumElements, TAlignment, TOverflowPolicy, TStats> &&other) : TStats(), head(0), elementsUsed(0)
     {
-        for (size_t i = 0; i < this->elementsUsed; i++)
-        {
-            this->GetIndexPointer(i)->~T();
-        }
+        this->TakeBuffer(other);
     }
 
-    template <typename T, size_t TNumElements>
-    typename Buffer<T, TNumElements>::iterator Buffer<T, TNumElements>::begin()
+    template <typename T, size_t TNumElements, size_t TAlignment, OverflowPolicy TOverflowPolicy, typename TStats>
+    Buffer<T, TNumElements, TAlignment, TOverflowPolicy, TStats>::~Buffer()
     {
-        return this->GetIndexPointer(0);
+        this->DestroyFront(this->elementsUsed);
     }
 
-    template <typename T, size_t TNumElements>
-    typename Buffer<T, TNumElements>::const_iterator Buffer<T, TNumElements>::begin() const
+    template <typename T, size_t TNumElements, size_t TAlignment, OverflowPolicy TOverflowPolicy, typename TStats>
+    typename Buffer<T, TNumElements, TAlignment, TOverflowPolicy, TStats>::iterator Buffer<T, TNumElements, TAlignment, TOverflowPolicy, TStats>::begin()
     {
-        return this->GetConstIndexPointer(0);
+        return iterator(this->GetStorage(), this->head);
     }
 
-    template <typename T, size_t TNumElements>
-    typename Buffer<T, TNumElements>::const_iterator Buffer<T, TNumElements>::cbegin() const
+    template <typename T, size_t TNumElements, size_t TAlignment, OverflowPolicy TOverflowPolicy, typename TStats>
+    typename Buffer<T, TNumElements, TAlignment, TOverflowPolicy, TStats>::const_iterator Buffer<T, TNumElements, TAlignment, TOverflowPolicy, TStats>::begin() const
     {
-        return this->GetConstIndexPointer(0);
+        return const_iterator(this->GetConstStorage(), this->head);
     }
 
-    template <typename T, size_t TNumElements>
-    typename Buffer<T, TNumElements>::iterator Buffer<T, TNumElements>::end()
+    template <typename T, size_t TNumElements, size_t TAlignment, OverflowPolicy TOverflowPolicy, typename TStats>
+    typename Buffer<T, TNumElements, TAlignment, TOverflowPolicy, TStats>::const_iterator Buffer<T, TNumElements, TAlignment, TOverflowPolicy, TStats>::cbegin() const
     {
-        return this->GetIndexPointer(this->elementsUsed);
+        return const_iterator(this->GetConstStorage(), this->head);
     }
 
-    template <typename T, size_t TNumElements>
-    typename Buffer<T, TNumElements>::const_iterator Buffer<T, TNumElements>::end() const
+    template <typename T, size_t TNumElements, size_t TAlignment, OverflowPolicy TOverflowPolicy, typename TStats>
+    typename Buffer<T, TNumElements, TAlignment, TOverflowPolicy, TStats>::iterator Buffer<T, TNumElements, TAlignment, TOverflowPolicy, TStats>::end()
     {
-        return this->GetConstIndexPointer(this->elementsUsed);
+        return iterator(this->GetStorage(), this->head + this->elementsUsed);
     }
 
-    template <typename T, size_t TNumElements>
-    typename Buffer<T, TNumElements>::const_iterator Buffer<T, TNumElements>::cend() const
+    template <typename T, size_t TNumElements, size_t TAlignment, OverflowPolicy TOverflowPolicy, typename TStats>
+    typename Buffer<T, TNumElements, TAlignment, TOverflowPolicy, TStats>::const_iterator Buffer<T, TNumElements, TAlignment, TOverflowPolicy, TStats>::end() const
     {
-        return this->GetConstIndexPointer(this->elementsUsed);
+        return const_iterator(this->GetConstStorage(), this->head + this->elementsUsed);
     }
 
-    template <typename T, size_t TNumElements>
-    void Buffer<T, TNumElements>::Remove(size_t count)
+    template <typename T, size_t TNumElements, size_t TAlignment, OverflowPolicy TOverflowPolicy, typename TStats>
+    typename Buffer<T, TNumElements, TAlignment, TOverflowPolicy, TStats>::const_iterator Buffer<T, TNumElements, TAlignment, TOverflowPolicy, TStats>::cend() const
+    {
+        return const_iterator(this->GetConstStorage(), this->head + this->elementsUsed);
+    }
+
+    template <typename T, size_t TNumElements, size_t TAlignment, OverflowPolicy TOverflowPolicy, typename TStats>
+    void Buffer<T, TNumElements, TAlignment, TOverflowPolicy, TStats>::Remove(size_t count)
     {
         size_t removeCount = count;
         if (removeCount > this->Size())
         {
             removeCount = this->Size();
         }
-        if (removeCount == this->Size())
-        {
-            memset(this->GetIndexPointer(0), 0, TNumElements * sizeof(T));
-            this->elementsUsed = 0;
-        }
-        else
-        {
-            memcpy(this->GetIndexPointer(0), this->GetConstIndexPointer(removeCount), (this->Size() - removeCount) * sizeof(T));
-            iterator newEnd = this->GetIndexPointer(this->Size());
-            const size_t kSetItemCount = (TNumElements - this->Size());
-            memset(newEnd, 0, kSetItemCount  * sizeof(T));
-            this->elementsUsed -= removeCount;
-        }
+        this->DropFront(removeCount);
+        this->RecordRemove(removeCount);
     }
 
-    template <typename T, size_t TNumElements>
-    void Buffer<T, TNumElements>::Add(const T &element)
+    template <typename T, size_t TNumElements, size_t TAlignment, OverflowPolicy TOverflowPolicy, typename TStats>
+    bool Buffer<T, TNumElements, TAlignment, TOverflowPolicy, TStats>::Add(const T &element)
     {
-        if (this->Size() == this->Capacity())
-        {
-            this->Remove(1);
-        }
-        iterator location = this->GetIndexPointer(this->Size());
-        new (location) T(element);
-        this->elementsUsed++;
+        return this->Emplace(element) != nullptr;
     }
 
-    template <typename T, size_t TNumElements>
-    void Buffer<T, TNumElements>::AddRange(const T *elements, size_t elementCount)
+    template <typename T, size_t TNumElements, size_t TAlignment, OverflowPolicy TOverflowPolicy, typename TStats>
+    bool Buffer<T, TNumElements, TAlignment, TOverflowPolicy, TStats>::Add(T &&element)
     {
-        const T *start = elements;
-        size_t count = elementCount;
-        if (elementCount > this->Capacity())
-        {
-            size_t diff = elementCount - this->Capacity();
-            start += diff;
-            count -= diff;
-        }
-        if (count > this->Capacity() - this->Size())
+        return this->Emplace(libEmbedded::move(element)) != nullptr;
+    }
+
+    template <typename T, size_t TNumElements, size_t TAlignment, OverflowPolicy TOverflowPolicy, typename TStats>
+    template <typename... TArgs>
+    T *Buffer<T, TNumElements, TAlignment, TOverflowPolicy, TStats>::Emplace(TArgs &&...args)
+    {
+        // Only dropping a element with a destructor can invalidate the arguments.
+        return this->EmplaceBack(libEmbedded::integral_constant<bool, TOverflowPolicy == OverflowPolicy::DROP_OLDEST && !libEmbedded::is_trivially_destructible<T>::value>(), libEmbedded::forward<TArgs>(args)...);
+    }
+
+    template <typename T, size_t TNumElements, size_t TAlignment, OverflowPolicy TOverflowPolicy, typename TStats>
+    size_t Buffer<T, TNumElements, TAlignment, TOverflowPolicy, TStats>::AddRange(const T *elements, size_t elementCount)
+    {
+        const size_t count = this->Admit(elementCount);
+        // Dropping the oldest keeps the newest (last) elements, rejecting keeps the ones that came first.
+        const T *start = TOverflowPolicy == OverflowPolicy::DROP_OLDEST ? elements + (elementCount - count) : elements;
+        this->ConstructBack(start, count);
+        this->RecordAdd(count, this->elementsUsed);
+        return count;
+    }
+
+    template <typename T, size_t TNumElements, size_t TAlignment, OverflowPolicy TOverflowPolicy, typename TStats>
+    template <typename TIterator>
+    size_t Buffer<T, TNumElements, TAlignment, TOverflowPolicy, TStats>::AddRange(TIterator begin, TIterator end)
+    {
+        size_t added = 0;
+        for (TIterator it = begin; it != end && this->Emplace(*it) != nullptr; ++it)
         {
-            size_t toRemove = count - (this->Capacity() - this->Size());
-            this->Remove(toRemove);
+            added++;
         }
-        for (size_t i = 0; i < count; i++)
+        return added;
+    }
+
+    template <typename T, size_t TNumElements, size_t TAlignment, OverflowPolicy TOverflowPolicy, typename TStats>
+    BufferSegments<T> Buffer<T, TNumElements, TAlignment, TOverflowPolicy, TStats>::Reserve(size_t count)
+    {
+        static_assert(libEmbedded::is_trivially_copyable<T>::value, "Reserve/Commit write into slots without a constructed T, this only works for trivially copyable types.");
+        const size_t usedBefore = this->elementsUsed;
+        const size_t wanted = this->MakeRoom(count);
+        if (this->elementsUsed != usedBefore)
         {
-            new (GetIndexPointer(Size())) T(start[i]);
-            this->elementsUsed++;
+            this->RecordOverflow(usedBefore - this->elementsUsed);
         }
+        T *tail = this->GetIndexPointer(this->elementsUsed);
+        const size_t untilEnd = static_cast<size_t>(this->GetStorage() + TNumElements - tail);
+        const size_t firstCount = wanted < untilEnd ? wanted : untilEnd;
+        return BufferSegments<T>{Span<T>(tail, firstCount), Span<T>(this->GetStorage(), wanted - firstCount)};
     }
 
-    template <typename T, size_t TNumElements>
-    size_t Buffer<T, TNumElements>::Size() const
+    template <typename T, size_t TNumElements, size_t TAlignment, OverflowPolicy TOverflowPolicy, typename TStats>
+    void Buffer<T, TNumElements, TAlignment, TOverflowPolicy, TStats>::Commit(size_t count)
+    {
+        const size_t freeCount = TNumElements - this->elementsUsed;
+        const size_t committed = count > freeCount ? freeCount : count;
+        this->elementsUsed += committed;
+        this->RecordAdd(committed, this->elementsUsed);
+    }
+
+    template <typename T, size_t TNumElements, size_t TAlignment, OverflowPolicy TOverflowPolicy, typename TStats>
+    BufferSegments<const T> Buffer<T, TNumElements, TAlignment, TOverflowPolicy, TStats>::Peek() const
+    {
+        const size_t firstCount = this->ContiguousFrom(0);
+        return BufferSegments<const T>{Span<const T>(this->GetConstIndexPointer(0), firstCount), Span<const T>(this->GetConstStorage(), this->elementsUsed - firstCount)};
+    }
+
+    template <typename T, size_t TNumElements, size_t TAlignment, OverflowPolicy TOverflowPolicy, typename TStats>
+    void Buffer<T, TNumElements, TAlignment, TOverflowPolicy, TStats>::Consume(size_t count)
+    {
+        this->Remove(count);
+    }
+
+    template <typename T, size_t TNumElements, size_t TAlignment, OverflowPolicy TOverflowPolicy, typename TStats>
+    size_t Buffer<T, TNumElements, TAlignment, TOverflowPolicy, TStats>::Size() const
     {
         return this->elementsUsed;
     }
 
-    template <typename T, size_t TNumElements>
-    size_t Buffer<T, TNumElements>::Capacity() const
+    template <typename T, size_t TNumElements, size_t TAlignment, OverflowPolicy TOverflowPolicy, typename TStats>
+    size_t Buffer<T, TNumElements, TAlignment, TOverflowPolicy, TStats>::Capacity() const
     {
         return TNumElements;
     }
 
-    template <typename T, size_t TNumElements>
-    Buffer<T, TNumElements> &Buffer<T, TNumElements>::operator=(const Buffer<T, TNumElements> &other)
+    template <typename T, size_t TNumElements, size_t TAlignment, OverflowPolicy TOverflowPolicy, typename TStats>
+    TStats &Buffer<T, TNumElements, TAlignment, TOverflowPolicy, TStats>::GetStats()
     {
-        this->Remove(this->elementsUsed);
-        this->AddRange(other.GetConstIndexPointer(0), other.elementsUsed);
         return *this;
     }
 
-    template <typename T, size_t TNumElements>
-    T &Buffer<T, TNumElements>::operator[](size_t index)
+    template <typename T, size_t TNumElements, size_t TAlignment, OverflowPolicy TOverflowPolicy, typename TStats>
+    const TStats &Buffer<T, TNumElements, TAlignment, TOverflowPolicy, TStats>::GetStats() const
+    {
+        return *this;
+    }
+
+    template <typename T, size_t TNumElements, size_t TAlignment, OverflowPolicy TOverflowPolicy, typename TStats>
+    Buffer<T, TNumElements, TAlignment, TOverflowPolicy, TStats> &Buffer<T, TNumElements, TAlignment, TOverflowPolicy, TStats>::operator=(const Buffer<T, TNumElements, TAlignment, TOverflowPolicy, TStats> &other)
+    {
+        if (this != &other)
+        {
+            this->DropFront(this->elementsUsed);
+            this->AppendBuffer(other);
+        }
+        return *this;
+    }
+
+    template <typename T, size_t TNumElements, size_t TAlignment, OverflowPolicy TOverflowPolicy, typename TStats>
+    Buffer<T, TNumElements, TAlignment, TOverflowPolicy, TStats> &Buffer<T, TNumElements, TAlignment, TOverflowPolicy, TStats>::operator=(Buffer<T, TNumElements, TAlignment, TOverflowPolicy, TStats> &&other)
+    {
+        if (this != &other)
+        {
+            this->DropFront(this->elementsUsed);
+            this->TakeBuffer(other);
+        }
+        return *this;
+    }
+
+    template <typename T, size_t TNumElements, size_t TAlignment, OverflowPolicy TOverflowPolicy, typename TStats>
+    T &Buffer<T, TNumElements, TAlignment, TOverflowPolicy, TStats>::operator[](size_t index)
     {
         return this->GetItem(index);
     }
 
-    template <typename T, size_t TNumElements>
-    const T &Buffer<T, TNumElements>::operator[](size_t index) const
+    template <typename T, size_t TNumElements, size_t TAlignment, OverflowPolicy TOverflowPolicy, typename TStats>
+    const T &Buffer<T, TNumElements, TAlignment, TOverflowPolicy, TStats>::operator[](size_t index) const
     {
         return this->GetItem(index);
     }
 
-    template <typename T, size_t TNumElements>
-    T &Buffer<T, TNumElements>::GetItem(size_t index)
+    template <typename T, size_t TNumElements, size_t TAlignment, OverflowPolicy TOverflowPolicy, typename TStats>
+    T &Buffer<T, TNumElements, TAlignment, TOverflowPolicy, TStats>::GetItem(size_t index)
     {
         return *this->GetIndexPointer(index);
     }
 
-    template <typename T, size_t TNumElements>
-    const T &Buffer<T, TNumElements>::GetItem(size_t index) const
+    template <typename T, size_t TNumElements, size_t TAlignment, OverflowPolicy TOverflowPolicy, typename TStats>
+    const T &Buffer<T, TNumElements, TAlignment, TOverflowPolicy, TStats>::GetItem(size_t index) const
     {
         return *this->GetConstIndexPointer(index);
     }
 
-    template <typename T, size_t TNumElements>
-    template <size_t TOtherNumElements>
-    bool Buffer<T, TNumElements>::operator==(const Buffer<T, TOtherNumElements> &other) const
+    template <typename T, size_t TNumElements, size_t TAlignment, OverflowPolicy TOverflowPolicy, typename TStats>
+    template <size_t TOtherNumElements, size_t TOtherAlignment, OverflowPolicy TOtherOverflowPolicy, typename TOtherStats>
+    bool Buffer<T, TNumElements, TAlignment, TOverflowPolicy, TStats>::operator==(const Buffer<T, TOtherNumElements, TOtherAlignment, TOtherOverflowPolicy, TOtherStats> &other) const
     {
         if (this->Size() != other.Size())
         {
             return false;
         }
-        for (size_t i = 0; i < this->elementsUsed; i++)
+        // Compare in chunks that are contiguous in both buffers (at most three).
+        size_t index = 0;
+        while (index < this->elementsUsed)
         {
-            if (this->GetItem(i) != other.GetItem(i))
+            const size_t thisCount = this->ContiguousFrom(index);
+            const size_t otherCount = other.ContiguousFrom(index);
+            const size_t count = thisCount < otherCount ? thisCount : otherCount;
+            if (!EqualElements(this->GetConstIndexPointer(index), other.GetConstIndexPointer(index), count))
             {
                 return false;
             }
+            index += count;
         }
         return true;
     }
 
-    template <typename T, size_t TNumElements>
-    template <size_t TOtherNumElements>
-    bool Buffer<T, TNumElements>::operator!=(const Buffer<T, TOtherNumElements> &other) const
+    template <typename T, size_t TNumElements, size_t TAlignment, OverflowPolicy TOverflowPolicy, typename TStats>
+    template <size_t TOtherNumElements, size_t TOtherAlignment, OverflowPolicy TOtherOverflowPolicy, typename TOtherStats>
+    bool Buffer<T, TNumElements, TAlignment, TOverflowPolicy, TStats>::operator!=(const Buffer<T, TOtherNumElements, TOtherAlignment, TOtherOverflowPolicy, TOtherStats> &other) const
     {
-        if (this->Size() != other.Size())
-        {
-            return true;
-        }
+        return !(*this == other);
+    }
 
-        bool allmatch = true;
-        for (size_t i = 0; i < other.Size(); i++)
-        {
-            if (this->GetItem(i) != other.GetItem(i))
-            {
-                allmatch = false;
-                break;
-            }
-        }
+    template <typename T, size_t TNumElements, size_t TAlignment, OverflowPolicy TOverflowPolicy, typename TStats>
+    void Buffer<T, TNumElements, TAlignment, TOverflowPolicy, TStats>::RawCopyFrom(const Buffer<T, TNumElements, TAlignment, TOverflowPolicy, TStats> &other)
+    {
+        static_assert(libEmbedded::is_trivially_copyable<T>::value, "Only a buffer of trivially copyable elements can be copied byte for byte.");
+        this->head = other.head;
+        this->elementsUsed = other.elementsUsed;
+        memcpy(&this->workspace, &other.workspace, sizeof(this->workspace));
+    }
 
-        return !allmatch;
+    template <typename T, size_t TNumElements, size_t TAlignment, OverflowPolicy TOverflowPolicy, typename TStats>
+    T *Buffer<T, TNumElements, TAlignment, TOverflowPolicy, TStats>::GetStorage()
+    {
+        return reinterpret_cast<T *>(this->workspace.data);
     }
 
-    template <typename T, size_t TNumElements>
-    typename Buffer<T, TNumElements>::iterator Buffer<T, TNumElements>::GetIndexPointer(size_t index)
+    template <typename T, size_t TNumElements, size_t TAlignment, OverflowPolicy TOverflowPolicy, typename TStats>
+    const T *Buffer<T, TNumElements, TAlignment, TOverflowPolicy, TStats>::GetConstStorage() const
     {
-        return iterator(this->workspace + (sizeof(T) * index));
+        return reinterpret_cast<const T *>(this->workspace.data);
     }
 
-    template <typename T, size_t TNumElements>
-    typename Buffer<T, TNumElements>::const_iterator Buffer<T, TNumElements>::GetConstIndexPointer(size_t index) const
+    template <typename T, size_t TNumElements, size_t TAlignment, OverflowPolicy TOverflowPolicy, typename TStats>
+    T *Buffer<T, TNumElements, TAlignment, TOverflowPolicy, TStats>::GetIndexPointer(size_t index)
+    {
+        return this->GetStorage() + Wrap(this->head + index);
+    }
+
+    template <typename T, size_t TNumElements, size_t TAlignment, OverflowPolicy TOverflowPolicy, typename TStats>
+    const T *Buffer<T, TNumElements, TAlignment, TOverflowPolicy, TStats>::GetConstIndexPointer(size_t index) const
     {
-        return const_iterator(this->workspace + (sizeof(T) * index));
+        return this->GetConstStorage() + Wrap(this->head + index);
     }
 } // namespace libEmbedded
 
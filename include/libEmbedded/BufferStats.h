@@ -0,0 +1,135 @@
+/**
+ * @file BufferStats.h
+ * @author Giel Willemsen
+ * @brief Compile time selected statistics policies for Buffer (adds, drops, removes and the high-water mark).
+ * @version 0.1 2026-10-17 Initial version
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * @details
+ * A Buffer derives (privately) from its stats policy so the empty NoBufferStats takes no space at all,
+ * and its empty inline Record methods disappear completely. The Record methods are protected, only the
+ * Buffer itself can call them, the owner of the buffer reads the numbers through GetStats().
+ * When the numbers have to be read from another thread use AtomicBufferStats (AtomicBufferStats.h) instead.
+ */
+#pragma once
+#ifndef LIBEMBEDDED_BUFFER_STATS_H
+#define LIBEMBEDDED_BUFFER_STATS_H
+#include <stddef.h>
+
+namespace libEmbedded
+{
+    /**
+     * @brief The numbers collected by a stats policy at one moment.
+     *
+     */
+    struct BufferStatsSnapshot
+    {
+        /**
+         * @brief The number of elements added to the buffer.
+         *
+         */
+        size_t adds;
+
+        /**
+         * @brief The number of elements lost because the buffer was full.
+         * Either old elements that were dropped (DROP_OLDEST) or new ones that were rejected (REJECT).
+         *
+         */
+        size_t drops;
+
+        /**
+         * @brief The number of add operations that ran into a full buffer and lost elements.
+         *
+         */
+        size_t overflows;
+
+        /**
+         * @brief The number of elements removed with Remove or Consume.
+         *
+         */
+        size_t removes;
+
+        /**
+         * @brief The largest Size() seen (the high-water mark).
+         *
+         */
+        size_t peakSize;
+    };
+
+    /**
+     * @brief Stats policy that doesn't collect anything, the default for a Buffer.
+     *
+     */
+    class NoBufferStats
+    {
+    protected:
+        void RecordAdd(size_t, size_t)
+        {
+        }
+
+        void RecordOverflow(size_t)
+        {
+        }
+
+        void RecordRemove(size_t)
+        {
+        }
+    };
+
+    /**
+     * @brief Stats policy with plain counters, for when the numbers are read from the same thread that uses the buffer.
+     *
+     */
+    class BufferStats
+    {
+    private:
+        BufferStatsSnapshot counters;
+
+    public:
+        constexpr BufferStats() : counters{0, 0, 0, 0, 0} {}
+
+        /**
+         * @brief Get the numbers collected since the construction or the last Reset.
+         *
+         * @return BufferStatsSnapshot The collected numbers.
+         */
+        BufferStatsSnapshot Snapshot() const
+        {
+            return this->counters;
+        }
+
+        /**
+         * @brief Start counting from zero again, the high-water mark included.
+         *
+         */
+        void Reset()
+        {
+            this->counters = BufferStatsSnapshot{0, 0, 0, 0, 0};
+        }
+
+    protected:
+        void RecordAdd(size_t count, size_t size)
+        {
+            this->counters.adds += count;
+            if (size > this->counters.peakSize)
+            {
+                this->counters.peakSize = size;
+            }
+        }
+
+        void RecordOverflow(size_t dropped)
+        {
+            this->counters.drops += dropped;
+            this->counters.overflows++;
+        }
+
+        void RecordRemove(size_t count)
+        {
+            this->counters.removes += count;
+        }
+    };
+} // namespace libEmbedded
+
+#endif // LIBEMBEDDED_BUFFER_STATS_H
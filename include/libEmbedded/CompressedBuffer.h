@@ -0,0 +1,379 @@
+/**
+ * @file CompressedBuffer.h
+ * @author Giel Willemsen
+ * @brief A append-only ring of integer samples stored as delta + zigzag + varint encoded blocks.
+ * @version 0.1 2026-10-17 Initial version
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * @details
+ * Every sample is stored as the difference with the sample before it. The difference is zigzag encoded (0, -1, 1,
+ * -2, 2, ... become 0, 1, 2, 3, 4, ...) so small negative differences are small numbers as well, and then written
+ * as a varint: 7 bits per byte, the high bit set on every byte but the last one. A slowly changing int32_t stream
+ * then takes 1 or 2 bytes per sample instead of 4.
+ * A varint stream can only be decoded from the start, so the storage is split in blocks of TBlockSize bytes and the
+ * first sample of each block is encoded relative to 0. When all blocks are full the oldest block is dropped as a
+ * whole, which makes room for the new samples without re-encoding anything. Reading is sequential only, through the
+ * decoding iterator.
+ */
+#pragma once
+#ifndef LIBEMBEDDED_COMPRESSED_BUFFER_H
+#define LIBEMBEDDED_COMPRESSED_BUFFER_H
+#include <stddef.h>
+#include <stdint.h>
+#include "libEmbedded/TypeTrait.h"
+#include "libEmbedded/Buffer.h"
+#include "libEmbedded/bits/Combining.h"
+#include "libEmbedded/bits/Extracting.h"
+#include "libEmbedded/bits/Util.h"
+
+namespace libEmbedded
+{
+    /**
+     * @brief Compressed ring of integer samples that drops the oldest block of samples when it is full.
+     * NOTE: How many samples fit depends on the data, a stream that changes slowly fits up to 4 times more (int32_t)
+     * samples than a Buffer of the same size, a stream of random values fits slightly less.
+     *
+     * @tparam T The type of the samples, a integral type of at most 64 bits.
+     * @tparam TNumBlocks The number of blocks, a power of two is the fastest.
+     * @tparam TBlockSize The size of one block in bytes. Larger blocks compress better (one sample per block is
+     * stored relative to 0), smaller blocks drop fewer samples at a time.
+     */
+    template <typename T, size_t TNumBlocks, size_t TBlockSize = 64>
+    class CompressedBuffer
+    {
+    public:
+        /**
+         * @brief The maximum number of bytes one encoded sample takes.
+         *
+         */
+        static constexpr size_t kMaxEncodedSize = ((bits::GetBitSize<T>() < 64 ? bits::GetBitSize<T>() + 1 : 64) + 6) / 7;
+
+        static_assert(libEmbedded::is_integral<T>::value && sizeof(T) <= sizeof(uint64_t), "T must be a integral type of at most 64 bits.");
+        static_assert(TNumBlocks > 0, "A CompressedBuffer needs at least one block.");
+        static_assert(TBlockSize >= kMaxEncodedSize, "A block must be able to hold at least one sample.");
+        static_assert(TBlockSize <= UINT16_MAX, "The number of samples in a block is kept in a uint16_t.");
+
+        /**
+         * @brief Readonly iterator that decodes the samples, oldest first.
+         * Adding to the buffer invalidates all iterators.
+         *
+         */
+        class ConstIterator
+        {
+        private:
+            const CompressedBuffer<T, TNumBlocks, TBlockSize> *buffer;
+            // Index of the sample in the buffer, used for comparing iterators.
+            size_t position;
+            // Index of the current block, counted from the oldest block.
+            size_t block;
+            // The next encoded sample in the current block.
+            const uint8_t *data;
+            // Number of samples in the current block after the current one.
+            size_t remaining;
+            T value;
+
+        public:
+            ConstIterator(const CompressedBuffer<T, TNumBlocks, TBlockSize> *buffer, size_t position)
+                : buffer(buffer), position(position), block(0), data(nullptr), remaining(0), value()
+            {
+                if (position == 0 && buffer->size > 0)
+                {
+                    this->LoadBlock(0);
+                }
+            }
+
+            const T &operator*() const
+            {
+                return this->value;
+            }
+
+            const T *operator->() const
+            {
+                return &this->value;
+            }
+
+            ConstIterator &operator++()
+            {
+                this->position++;
+                if (this->remaining > 0)
+                {
+                    this->remaining--;
+                    this->value = Decode(this->data, this->value);
+                }
+                else if (this->block + 1 < this->buffer->blockCount)
+                {
+                    this->LoadBlock(this->block + 1);
+                }
+                return *this;
+            }
+
+            ConstIterator operator++(int)
+            {
+                ConstIterator old = *this;
+                ++(*this);
+                return old;
+            }
+
+            bool operator==(const ConstIterator &other) const
+            {
+                return this->position == other.position;
+            }
+
+            bool operator!=(const ConstIterator &other) const
+            {
+                return !(*this == other);
+            }
+
+        private:
+            void LoadBlock(size_t block)
+            {
+                this->block = block;
+                const size_t index = this->buffer->GetBlockIndex(block);
+                this->data = this->buffer->blocks[index];
+                this->remaining = this->buffer->counts[index] - 1;
+                this->value = Decode(this->data, T(0));
+            }
+        };
+
+        typedef ConstIterator const_iterator;
+
+    private:
+        uint8_t blocks[TNumBlocks][TBlockSize];
+        // Number of samples per block.
+        uint16_t counts[TNumBlocks];
+        size_t firstBlock;
+        size_t blockCount;
+        // Number of bytes used in the newest block.
+        size_t bytesUsed;
+        size_t size;
+        T last;
+
+    public:
+        /**
+         * @brief Construct a new empty buffer.
+         *
+         */
+        CompressedBuffer() : firstBlock(0), blockCount(0), bytesUsed(0), size(0), last() {}
+
+        /**
+         * @brief Add a sample to the back of the buffer, dropping the oldest block when there is no room left.
+         *
+         * @param value The sample to add.
+         */
+        void Add(const T &value);
+
+        /**
+         * @brief Drop the oldest block of samples.
+         *
+         * @return size_t The number of samples dropped, 0 for an empty buffer.
+         */
+        size_t RemoveBlock();
+
+        /**
+         * @brief Remove all samples.
+         *
+         */
+        void Clear();
+
+        /**
+         * @brief Returns the number of samples in the buffer.
+         *
+         * @return size_t The number of samples.
+         */
+        size_t Size() const;
+
+        /**
+         * @brief Returns the number of blocks in use.
+         *
+         * @return size_t The number of blocks in use.
+         */
+        size_t BlockCount() const;
+
+        /**
+         * @brief Returns the number of bytes of storage in use, the unused bytes at the end of a older block included.
+         *
+         * @return size_t The number of bytes in use, at most TNumBlocks * TBlockSize.
+         */
+        size_t BytesUsed() const;
+
+        /**
+         * @brief Returns the newest sample.
+         * Warning: The buffer may not be empty!
+         *
+         * @return const T& The newest sample.
+         */
+        const T &Back() const;
+
+        /**
+         * @brief Retrieve a iterator that decodes from the oldest sample.
+         *
+         * @return const_iterator The iterator at the oldest sample.
+         */
+        const_iterator begin() const;
+
+        /**
+         * @brief Retrieve a iterator to the end of the buffer.
+         *
+         * @return const_iterator The iterator one past the newest sample.
+         */
+        const_iterator end() const;
+
+    private:
+        static constexpr size_t Wrap(size_t index)
+        {
+            return BufferIndex<TNumBlocks>::Wrap(index);
+        }
+
+        size_t GetBlockIndex(size_t block) const
+        {
+            return Wrap(this->firstBlock + block);
+        }
+
+        static uint64_t ZigZag(T value, T previous);
+
+        static size_t EncodedSize(uint64_t encoded);
+
+        /**
+         * @brief Decode the encoded sample at data and advance data past it.
+         *
+         * @param data The encoded sample.
+         * @param previous The sample before it (0 for the first sample of a block).
+         * @return T The decoded sample.
+         */
+        static T Decode(const uint8_t *&data, T previous);
+    };
+
+    template <typename T, size_t TNumBlocks, size_t TBlockSize>
+    void CompressedBuffer<T, TNumBlocks, TBlockSize>::Add(const T &value)
+    {
+        uint64_t encoded = ZigZag(value, this->blockCount > 0 ? this->last : T(0));
+        size_t encodedSize = EncodedSize(encoded);
+        if (this->blockCount == 0 || this->bytesUsed + encodedSize > TBlockSize)
+        {
+            if (this->blockCount == TNumBlocks)
+            {
+                this->RemoveBlock();
+            }
+            this->counts[this->GetBlockIndex(this->blockCount)] = 0;
+            this->blockCount++;
+            this->bytesUsed = 0;
+            // The first sample of a block is stored relative to 0, so the block can be decoded on its own.
+            encoded = ZigZag(value, T(0));
+            encodedSize = EncodedSize(encoded);
+        }
+        const size_t index = this->GetBlockIndex(this->blockCount - 1);
+        uint8_t *data = &this->blocks[index][this->bytesUsed];
+        for (size_t i = 0; i < encodedSize - 1; i++)
+        {
+            data[i] = static_cast<uint8_t>(bits::ExtractBits<uint64_t>(encoded, i * 7, 7) | 0x80);
+        }
+        data[encodedSize - 1] = static_cast<uint8_t>(bits::ExtractBits<uint64_t>(encoded, (encodedSize - 1) * 7, 7));
+        this->bytesUsed += encodedSize;
+        this->counts[index]++;
+        this->size++;
+        this->last = value;
+    }
+
+    template <typename T, size_t TNumBlocks, size_t TBlockSize>
+    size_t CompressedBuffer<T, TNumBlocks, TBlockSize>::RemoveBlock()
+    {
+        if (this->blockCount == 0)
+        {
+            return 0;
+        }
+        const size_t dropped = this->counts[this->firstBlock];
+        this->firstBlock = Wrap(this->firstBlock + 1);
+        this->blockCount--;
+        this->size -= dropped;
+        if (this->blockCount == 0)
+        {
+            this->bytesUsed = 0;
+        }
+        return dropped;
+    }
+
+    template <typename T, size_t TNumBlocks, size_t TBlockSize>
+    void CompressedBuffer<T, TNumBlocks, TBlockSize>::Clear()
+    {
+        this->firstBlock = 0;
+        this->blockCount = 0;
+        this->bytesUsed = 0;
+        this->size = 0;
+    }
+
+    template <typename T, size_t TNumBlocks, size_t TBlockSize>
+    size_t CompressedBuffer<T, TNumBlocks, TBlockSize>::Size() const
+    {
+        return this->size;
+    }
+
+    template <typename T, size_t TNumBlocks, size_t TBlockSize>
+    size_t CompressedBuffer<T, TNumBlocks, TBlockSize>::BlockCount() const
+    {
+        return this->blockCount;
+    }
+
+    template <typename T, size_t TNumBlocks, size_t TBlockSize>
+    size_t CompressedBuffer<T, TNumBlocks, TBlockSize>::BytesUsed() const
+    {
+        return this->blockCount == 0 ? 0 : (this->blockCount - 1) * TBlockSize + this->bytesUsed;
+    }
+
+    template <typename T, size_t TNumBlocks, size_t TBlockSize>
+    const T &CompressedBuffer<T, TNumBlocks, TBlockSize>::Back() const
+    {
+        return this->last;
+    }
+
+    template <typename T, size_t TNumBlocks, size_t TBlockSize>
+    typename CompressedBuffer<T, TNumBlocks, TBlockSize>::const_iterator CompressedBuffer<T, TNumBlocks, TBlockSize>::begin() const
+    {
+        return const_iterator(this, 0);
+    }
+
+    template <typename T, size_t TNumBlocks, size_t TBlockSize>
+    typename CompressedBuffer<T, TNumBlocks, TBlockSize>::const_iterator CompressedBuffer<T, TNumBlocks, TBlockSize>::end() const
+    {
+        return const_iterator(this, this->size);
+    }
+
+    template <typename T, size_t TNumBlocks, size_t TBlockSize>
+    uint64_t CompressedBuffer<T, TNumBlocks, TBlockSize>::ZigZag(T value, T previous)
+    {
+        // Modulo 2^64, so the difference of any two 64 bit values fits.
+        const uint64_t delta = static_cast<uint64_t>(value) - static_cast<uint64_t>(previous);
+        return (delta << 1) ^ (0 - (delta >> 63));
+    }
+
+    template <typename T, size_t TNumBlocks, size_t TBlockSize>
+    size_t CompressedBuffer<T, TNumBlocks, TBlockSize>::EncodedSize(uint64_t encoded)
+    {
+        size_t encodedSize = 1;
+        while (encoded >= 0x80)
+        {
+            encoded >>= 7;
+            encodedSize++;
+        }
+        return encodedSize;
+    }
+
+    template <typename T, size_t TNumBlocks, size_t TBlockSize>
+    T CompressedBuffer<T, TNumBlocks, TBlockSize>::Decode(const uint8_t *&data, T previous)
+    {
+        uint64_t encoded = 0;
+        size_t shift = 0;
+        uint8_t byte;
+        do
+        {
+            byte = *data++;
+            encoded = bits::SetBits<uint8_t, uint64_t>(encoded, byte, shift, 7);
+            shift += 7;
+        } while ((byte & 0x80) != 0);
+        const uint64_t delta = (encoded >> 1) ^ (0 - (encoded & 1));
+        return static_cast<T>(static_cast<uint64_t>(previous) + delta);
+    }
+} // namespace libEmbedded
+
+#endif // LIBEMBEDDED_COMPRESSED_BUFFER_H
@@ -0,0 +1,89 @@
+/**
+ * @file DoubleBuffer.h
+ * @author Giel Willemsen
+ * @brief A front and a back value that are swapped, for a writer and a reader that take turns.
+ * @version 0.1 2026-10-17 Initial version
+ * @version 0.2 2026-10-17 The front index is atomic, so a Swap in a interrupt or other thread is seen by the reader.
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * @details
+ * The writer builds the next value in the back slot while the reader uses the front slot, Swap exchanges the two
+ * by flipping a index (nothing is copied). Swap must be called when nobody is using either slot, for example at
+ * the end of a control loop iteration, or from a interrupt while the main loop is not in the middle of a read.
+ * The index is a std::atomic, Swap stores it with release and Front/Back load it with acquire. So the reader never
+ * keeps a stale index in a register and the writes to the back slot are visible before the index that publishes
+ * them, also when the swap happens in a interrupt or on another thread. Nothing stops a swap in the middle of a
+ * read though: when the writer and the reader run concurrently use a TripleBuffer instead.
+ */
+#pragma once
+#ifndef LIBEMBEDDED_DOUBLE_BUFFER_H
+#define LIBEMBEDDED_DOUBLE_BUFFER_H
+#include <stddef.h>
+#include <atomic>
+
+namespace libEmbedded
+{
+    /**
+     * @brief Two slots of T that swap between a writer and a reader.
+     *
+     * @tparam T The type of the value, default constructible.
+     */
+    template <typename T>
+    class DoubleBuffer
+    {
+    private:
+        T slots[2];
+        std::atomic<size_t> front;
+
+    public:
+        /**
+         * @brief Construct a new double buffer, both slots default constructed.
+         *
+         */
+        DoubleBuffer() : slots(), front(0) {}
+
+        /**
+         * @brief The slot to build the next value in.
+         *
+         * @return T& The back slot.
+         */
+        T &Back();
+
+        /**
+         * @brief The value made available by the last Swap.
+         *
+         * @return const T& The front slot.
+         */
+        const T &Front() const;
+
+        /**
+         * @brief Make the back slot the front slot and the other way around.
+         * The new back slot holds the value before, copy it over first when the writer only changes a part of it.
+         *
+         */
+        void Swap();
+    };
+
+    template <typename T>
+    T &DoubleBuffer<T>::Back()
+    {
+        return this->slots[this->front.load(std::memory_order_acquire) ^ 1];
+    }
+
+    template <typename T>
+    const T &DoubleBuffer<T>::Front() const
+    {
+        return this->slots[this->front.load(std::memory_order_acquire)];
+    }
+
+    template <typename T>
+    void DoubleBuffer<T>::Swap()
+    {
+        // Only the swapping side writes the index, so a plain load and store is enough (no read-modify-write).
+        this->front.store(this->front.load(std::memory_order_relaxed) ^ 1, std::memory_order_release);
+    }
+} // namespace libEmbedded
+
+#endif // LIBEMBEDDED_DOUBLE_BUFFER_H
@@ -6,7 +6,9 @@
  * @version 0.2 2022-05-28 Cleanup and fixed negative rounding problem.
  * @version 0.3 2022-05-29 Removed dependency on math.h abs function.
  * @version 0.4 2022-10-30 DivideAndRoundUp is now a single statement (C++11 conformity).
- * @date 2022-10-30
+ * @version 0.5 2026-10-17 Addition of kCacheLineSize.
+ * @version 0.6 2026-10-17 Addition of IsPowerOfTwo.
+ * @date 2026-10-17
  *
  * @copyright Copyright (c) 2022
  *
@@ -19,6 +21,12 @@
 
 namespace libEmbedded
 {
+    /**
+     * @brief The assumed size of a cache line in bytes. Used to keep data that is written by different threads
+     * on separate cache lines (preventing false sharing).
+     */
+    constexpr size_t kCacheLineSize = 64;
+
     /**
      * @brief Divide the value by the divider and round the given value UP to closes T value.
      * Note: No floating point math required.
@@ -58,6 +66,18 @@ namespace libEmbedded
     {
         return (input > max) ? max : ((input < min) ? min : input);
     }
+
+    /**
+     * @brief Check if the value is a power of two (1, 2, 4, 8, ...).
+     *
+     * @param value The value to check.
+     * @return true If exactly one bit is set in the value.
+     * @return false If the value is 0 or has more than one bit set.
+     */
+    constexpr bool IsPowerOfTwo(size_t value)
+    {
+        return value != 0 && (value & (value - 1)) == 0;
+    }
 } // namespace libEmbedded
 
 #endif // LIBEMBEDDED_HELPERS_H
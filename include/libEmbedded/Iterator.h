@@ -5,7 +5,8 @@
  * @version 0.1 2022-06-14 Imported iterator helpers from Span.h and added a FindStartOf helper to search in iterators.
  * @version 0.2 2022-10-28 Depend on own type_trait library and don't expect others to include type_trait for us.
  * @version 0.3 2022-10-30 More strict C++11.
- * @date 2022-10-30
+ * @version 0.4 2026-10-17 Distance, Advance, Next and Prev are O(1) for random access iterators (dispatch on the iterator category).
+ * @date 2026-10-17
  *
  * @copyright Copyright (c) 2022
  *
@@ -18,8 +19,21 @@
 
 namespace libEmbedded
 {
+    template <typename TIter, typename TDiffType>
+    constexpr TDiffType Distance(TIter begin, TIter end, forward_iterator_tag)
+    {
+        return begin == end ? 0 : Distance<TIter, TDiffType>(++begin, end, forward_iterator_tag()) + 1;
+    }
+
+    template <typename TIter, typename TDiffType>
+    constexpr TDiffType Distance(TIter begin, TIter end, random_access_iterator_tag)
+    {
+        return static_cast<TDiffType>(end - begin);
+    }
+
     /**
      * @brief Calculates the number of values between begin and end.
+     * O(1) for pointers and random access iterators, otherwise it steps (recursively) from begin to end.
      *
      * @tparam TIter The type of the iterators.
      * @tparam TDiffType The type to count the distance in.
@@ -30,7 +44,7 @@ namespace libEmbedded
     template <typename TIter, typename TDiffType = size_t>
     constexpr TDiffType Distance(TIter begin, TIter end)
     {
-        return begin == end ? 0 : Distance(++begin, end) + 1;
+        return Distance<TIter, TDiffType>(begin, end, typename iterator_traits<TIter>::iterator_category());
     }
 
     /**
@@ -47,8 +61,24 @@ namespace libEmbedded
         return Distance<typename TContainer::const_iterator, TDiffType>(container.cbegin(), container.cend());
     }
 
+    template <typename TIter>
+    void Advance(TIter &it, size_t n, forward_iterator_tag)
+    {
+        while (n > 0)
+        {
+            ++it;
+            --n;
+        }
+    }
+
+    template <typename TIter>
+    void Advance(TIter &it, size_t n, random_access_iterator_tag)
+    {
+        it += n;
+    }
+
     /**
-     * @brief Increments it n number of times.
+     * @brief Increments it n number of times (O(1) for pointers and random access iterators).
      *
      * @tparam TIter The type of the iterator to increment.
      * @param it The iterator to increment.
@@ -57,15 +87,24 @@ namespace libEmbedded
     template <typename TIter>
     void Advance(TIter &it, size_t n = 1)
     {
-        while (n > 0)
-        {
-            ++it;
-            --n;
-        }
+        Advance(it, n, typename iterator_traits<TIter>::iterator_category());
+    }
+
+    template <typename TIter>
+    constexpr TIter Next(TIter it, size_t n, forward_iterator_tag)
+    {
+        return n == 0 ? it : Next(++it, n - 1, forward_iterator_tag());
+    }
+
+    template <typename TIter>
+    constexpr TIter Next(TIter it, size_t n, random_access_iterator_tag)
+    {
+        return it + n;
     }
 
     /**
      * @brief Increments it n number of times and returns this iterator.
+     * O(1) for pointers and random access iterators, otherwise it steps (recursively).
      *
      * @tparam TIter The type of the iterator to increment.
      * @param it The iterator to increment.
@@ -75,11 +114,24 @@ namespace libEmbedded
     template <typename TIter>
     constexpr TIter Next(TIter it, size_t n = 1)
     {
-        return n == 0 ? it : Next(++it, n - 1);
+        return Next(it, n, typename iterator_traits<TIter>::iterator_category());
+    }
+
+    template <typename TIter>
+    constexpr TIter Prev(TIter it, size_t n, forward_iterator_tag)
+    {
+        return n == 0 ? it : Prev(--it, n - 1, forward_iterator_tag());
+    }
+
+    template <typename TIter>
+    constexpr TIter Prev(TIter it, size_t n, random_access_iterator_tag)
+    {
+        return it - n;
     }
 
     /**
      * @brief Decrement it n number of times and returns this iterator.
+     * O(1) for pointers and random access iterators, otherwise it steps (recursively).
      *
      * @tparam TIter The type of the iterator to decrement.
      * @param it The iterator to decrement.
@@ -89,7 +141,7 @@ namespace libEmbedded
     template <typename TIter>
     constexpr TIter Prev(TIter it, size_t n = 1)
     {
-        return n == 0 ? it : Prev(--it, n - 1);
+        return Prev(it, n, typename iterator_traits<TIter>::iterator_category());
     }
 
     /**
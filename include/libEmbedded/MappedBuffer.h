@@ -0,0 +1,491 @@
+/**
+ * @file MappedBuffer.h
+ * @author Giel Willemsen
+ * @brief A drop-oldest ring like Buffer, but over a memory region provided by the caller (for example a mmap'ed file).
+ * @version 0.1 2026-10-17 Initial version
+ * @version 0.2 2026-10-17 The wrapped head is cached, no 64-bit modulo per element access.
+ * @version 0.3 2026-10-17 The cached head follows changes of begin made through other views of the same region.
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * @details
+ * The region starts with a small MappedBufferHeader followed by the elements, so the contents of a (shared) mapped
+ * file survive a crash of the process and can be attached to again and read without any deserialization.
+ * The header stores the free-running index of the oldest element (begin) and of one past the newest element (end)
+ * instead of a index and a count. Every change to the contents then only has to move one of the two forward:
+ * a Add on a full buffer first moves begin past the slot that gets overwritten, then writes the element and then
+ * moves end. A crash between any of these steps still leaves a valid (at most one element shorter) buffer.
+ * The steps are kept in this order with a signal fence, a crash is seen by the memory just like a signal handler
+ * running on the same thread would see it.
+ * Surviving a crash of the machine (power loss) needs the caller to flush the region (msync) as well.
+ * When attaching, the header is validated: a region without the magic number is formatted, a header of a different
+ * layout version, element size or capacity is never touched and begin/end that can't be right are repaired.
+ * The elements themselves are not checksummed, so T should be a type where every bit pattern is acceptable.
+ * The slot of the oldest element is cached together with the begin it was computed from. Begin modulo the capacity is
+ * only computed again when begin was moved by another view of the same region (a copy, or a second MappedBuffer
+ * attached to it), every other index is wrapped with BufferIndex. So the 64-bit indices don't need a division per
+ * access on 32-bit targets, while any number of views on one region stay correct (as long as they don't write at the
+ * same time).
+ */
+#pragma once
+#ifndef LIBEMBEDDED_MAPPED_BUFFER_H
+#define LIBEMBEDDED_MAPPED_BUFFER_H
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <atomic>
+#include "libEmbedded/TypeTrait.h"
+#include "libEmbedded/Buffer.h"
+
+namespace libEmbedded
+{
+    /**
+     * @brief The header at the start of the region of a MappedBuffer, all fields have a fixed size.
+     *
+     */
+    struct MappedBufferHeader
+    {
+        /**
+         * @brief kMagic when the region holds a MappedBuffer.
+         *
+         */
+        uint32_t magic;
+
+        /**
+         * @brief The version of the layout (kVersion).
+         *
+         */
+        uint16_t version;
+
+        /**
+         * @brief Offset of the first element from the start of the header.
+         *
+         */
+        uint16_t dataOffset;
+
+        /**
+         * @brief sizeof(T) of the elements.
+         *
+         */
+        uint32_t elementSize;
+
+        /**
+         * @brief The number of elements that fit in the region.
+         *
+         */
+        uint32_t capacity;
+
+        /**
+         * @brief Free-running index of the oldest element.
+         *
+         */
+        uint64_t begin;
+
+        /**
+         * @brief Free-running index one passed the newest element.
+         *
+         */
+        uint64_t end;
+
+        /**
+         * @brief "LEMB" in little endian.
+         *
+         */
+        static constexpr uint32_t kMagic = 0x424D454C;
+
+        /**
+         * @brief The current version of the layout.
+         *
+         */
+        static constexpr uint16_t kVersion = 1;
+    };
+
+    /**
+     * @brief The result of attaching a MappedBuffer to a region.
+     *
+     */
+    enum class MappedBufferStatus
+    {
+        /**
+         * @brief The region didn't hold a MappedBuffer yet, a new empty one is created in it.
+         */
+        FORMATTED,
+
+        /**
+         * @brief The region held a valid MappedBuffer, its elements are available again.
+         */
+        RECOVERED,
+
+        /**
+         * @brief The region held a MappedBuffer with a impossible begin/end, these are clamped to the capacity.
+         */
+        REPAIRED,
+
+        /**
+         * @brief The region is too small for the header and TNumElements elements, nothing is attached.
+         */
+        TOO_SMALL,
+
+        /**
+         * @brief The region is not aligned for the header or T, nothing is attached.
+         */
+        MISALIGNED,
+
+        /**
+         * @brief The region holds a MappedBuffer of a other version, element size or capacity. Nothing is attached
+         * and the region is left untouched, use Format to overwrite it anyway.
+         */
+        INCOMPATIBLE
+    };
+
+    /**
+     * @brief Ring buffer of a static size over caller provided memory that drops the oldest elements once space runs out.
+     * Only for trivially copyable types, the elements are stored as plain bytes in the region.
+     *
+     * @tparam T The type of the element in the buffer.
+     * @tparam TNumElements The maximum number of elements in the buffer.
+     */
+    template <typename T, size_t TNumElements>
+    class MappedBuffer
+    {
+        static_assert(libEmbedded::is_trivially_copyable<T>::value, "A MappedBuffer stores the elements as bytes, T must be trivially copyable.");
+        static_assert(TNumElements > 0 && TNumElements <= 0xFFFFFFFFu, "The capacity must fit in the header.");
+
+    public:
+        typedef BufferIterator<const T, TNumElements> const_iterator;
+
+        /**
+         * @brief The offset of the first element in the region.
+         *
+         */
+        static constexpr size_t kDataOffset = (sizeof(MappedBufferHeader) + alignof(T) - 1) / alignof(T) * alignof(T);
+
+        /**
+         * @brief The required alignment of the region.
+         *
+         */
+        static constexpr size_t kRegionAlignment = alignof(MappedBufferHeader) > alignof(T) ? alignof(MappedBufferHeader) : alignof(T);
+
+        /**
+         * @brief The number of bytes the region needs.
+         *
+         */
+        static constexpr size_t kRegionSize = kDataOffset + TNumElements * sizeof(T);
+
+    private:
+        MappedBufferHeader *header;
+        T *storage;
+        // Slot of the oldest element, headBegin (the header->begin it was computed from) wrapped to the capacity.
+        mutable uint64_t headBegin;
+        mutable size_t head;
+
+    public:
+        /**
+         * @brief Construct a buffer that is not attached to a region yet.
+         *
+         */
+        constexpr MappedBuffer() : header(nullptr), storage(nullptr), headBegin(0), head(0) {}
+
+        /**
+         * @brief Use the given region, recovering the elements that are already in it.
+         *
+         * @param region The start of the region, aligned to kRegionAlignment.
+         * @param regionSize The size of the region in bytes, at least kRegionSize.
+         * @return MappedBufferStatus How the region was attached, or why it wasn't.
+         */
+        MappedBufferStatus Attach(void *region, size_t regionSize);
+
+        /**
+         * @brief Use the given region and start with a empty buffer, whatever was in the region before.
+         *
+         * @param region The start of the region, aligned to kRegionAlignment.
+         * @param regionSize The size of the region in bytes, at least kRegionSize.
+         * @return MappedBufferStatus FORMATTED, or why the region couldn't be used.
+         */
+        MappedBufferStatus Format(void *region, size_t regionSize);
+
+        /**
+         * @brief Check if the buffer is attached to a region. All the other methods need a attached buffer.
+         *
+         * @return true If the buffer is attached.
+         * @return false If the buffer is not attached.
+         */
+        bool IsAttached() const;
+
+        /**
+         * @brief Adds the given element to the back of the buffer. Poping at the beginning if necessary.
+         *
+         * @param element The element to add to the buffer.
+         */
+        void Add(const T &element);
+
+        /**
+         * @brief Adds the given elements to the back of the buffer. Poping at the beginning if necessary.
+         * If elementCount is more than fit in the buffer only the last of the given elements are preserved.
+         *
+         * @param elements The elements to add to the buffer.
+         * @param elementCount The number of elements to add to the buffer.
+         */
+        void AddRange(const T *elements, size_t elementCount);
+
+        /**
+         * @brief Remove count elements from the beginning of the buffer.
+         *
+         * @param count The number of elements to remove, clamped to the Size.
+         */
+        void Remove(size_t count);
+
+        /**
+         * @brief Returns the number of elements in the buffer.
+         *
+         * @return size_t The number of elements in the buffer.
+         */
+        size_t Size() const;
+
+        /**
+         * @brief Returns the maximum number of elements that could possibly be in the buffer.
+         *
+         * @return size_t The maximum number of elements possible in the buffer.
+         */
+        size_t Capacity() const;
+
+        /**
+         * @brief Retrieve the element at the given index of the buffer (0 is the oldest).
+         * Warning: No bounds check!
+         *
+         * @param index The index to get the item from.
+         * @return The constant reference to the item at the given index.
+         */
+        const T &operator[](size_t index) const;
+
+        const_iterator begin() const;
+        const_iterator end() const;
+        const_iterator cbegin() const;
+        const_iterator cend() const;
+
+    private:
+        static bool Validate(MappedBufferHeader &header);
+
+        static bool CheckRegion(const void *region, size_t regionSize, MappedBufferStatus &problem);
+
+        void Use(void *region);
+
+        static constexpr size_t Wrap(size_t index)
+        {
+            return BufferIndex<TNumElements>::Wrap(index);
+        }
+
+        size_t Head() const
+        {
+            if (this->header->begin != this->headBegin)
+            {
+                // Another view of the region moved begin.
+                this->headBegin = this->header->begin;
+                this->head = static_cast<size_t>(this->headBegin % TNumElements);
+            }
+            return this->head;
+        }
+
+        void DropFront(size_t count)
+        {
+            const size_t current = this->Head();
+            this->header->begin += count;
+            this->headBegin = this->header->begin;
+            this->head = Wrap(current + count);
+        }
+
+        static void Publish()
+        {
+            // Keep the writes to the elements and the header in program order, as seen by a crash.
+            std::atomic_signal_fence(std::memory_order_seq_cst);
+        }
+    };
+
+    template <typename T, size_t TNumElements>
+    constexpr size_t MappedBuffer<T, TNumElements>::kDataOffset;
+
+    template <typename T, size_t TNumElements>
+    constexpr size_t MappedBuffer<T, TNumElements>::kRegionAlignment;
+
+    template <typename T, size_t TNumElements>
+    constexpr size_t MappedBuffer<T, TNumElements>::kRegionSize;
+
+    template <typename T, size_t TNumElements>
+    MappedBufferStatus MappedBuffer<T, TNumElements>::Attach(void *region, size_t regionSize)
+    {
+        MappedBufferStatus problem;
+        if (!CheckRegion(region, regionSize, problem))
+        {
+            return problem;
+        }
+        MappedBufferHeader *existing = static_cast<MappedBufferHeader *>(region);
+        if (existing->magic != MappedBufferHeader::kMagic)
+        {
+            return this->Format(region, regionSize);
+        }
+        if (existing->version != MappedBufferHeader::kVersion || existing->dataOffset != kDataOffset ||
+            existing->elementSize != sizeof(T) || existing->capacity != TNumElements)
+        {
+            return MappedBufferStatus::INCOMPATIBLE;
+        }
+        const bool valid = Validate(*existing);
+        this->Use(region);
+        return valid ? MappedBufferStatus::RECOVERED : MappedBufferStatus::REPAIRED;
+    }
+
+    template <typename T, size_t TNumElements>
+    MappedBufferStatus MappedBuffer<T, TNumElements>::Format(void *region, size_t regionSize)
+    {
+        MappedBufferStatus problem;
+        if (!CheckRegion(region, regionSize, problem))
+        {
+            return problem;
+        }
+        MappedBufferHeader *fresh = static_cast<MappedBufferHeader *>(region);
+        // Invalidate first so a crash while formatting is formatted again on the next Attach.
+        fresh->magic = 0;
+        Publish();
+        fresh->version = MappedBufferHeader::kVersion;
+        fresh->dataOffset = static_cast<uint16_t>(kDataOffset);
+        fresh->elementSize = static_cast<uint32_t>(sizeof(T));
+        fresh->capacity = static_cast<uint32_t>(TNumElements);
+        fresh->begin = 0;
+        fresh->end = 0;
+        Publish();
+        fresh->magic = MappedBufferHeader::kMagic;
+        this->Use(region);
+        return MappedBufferStatus::FORMATTED;
+    }
+
+    template <typename T, size_t TNumElements>
+    bool MappedBuffer<T, TNumElements>::IsAttached() const
+    {
+        return this->header != nullptr;
+    }
+
+    template <typename T, size_t TNumElements>
+    void MappedBuffer<T, TNumElements>::Add(const T &element)
+    {
+        this->AddRange(&element, 1);
+    }
+
+    template <typename T, size_t TNumElements>
+    void MappedBuffer<T, TNumElements>::AddRange(const T *elements, size_t elementCount)
+    {
+        const T *start = elements;
+        size_t count = elementCount;
+        if (count > TNumElements)
+        {
+            start += count - TNumElements;
+            count = TNumElements;
+        }
+        const size_t freeCount = TNumElements - this->Size();
+        if (count > freeCount)
+        {
+            // Drop the oldest first so the slots that are about to be overwritten are never part of the buffer.
+            this->DropFront(count - freeCount);
+            Publish();
+        }
+        const size_t tail = Wrap(this->Head() + this->Size());
+        const size_t firstCount = count < TNumElements - tail ? count : TNumElements - tail;
+        memcpy(this->storage + tail, start, firstCount * sizeof(T));
+        memcpy(this->storage, start + firstCount, (count - firstCount) * sizeof(T));
+        Publish();
+        this->header->end += count;
+    }
+
+    template <typename T, size_t TNumElements>
+    void MappedBuffer<T, TNumElements>::Remove(size_t count)
+    {
+        const size_t size = this->Size();
+        this->DropFront(count > size ? size : count);
+    }
+
+    template <typename T, size_t TNumElements>
+    size_t MappedBuffer<T, TNumElements>::Size() const
+    {
+        return static_cast<size_t>(this->header->end - this->header->begin);
+    }
+
+    template <typename T, size_t TNumElements>
+    size_t MappedBuffer<T, TNumElements>::Capacity() const
+    {
+        return TNumElements;
+    }
+
+    template <typename T, size_t TNumElements>
+    const T &MappedBuffer<T, TNumElements>::operator[](size_t index) const
+    {
+        return this->storage[Wrap(this->Head() + index)];
+    }
+
+    template <typename T, size_t TNumElements>
+    typename MappedBuffer<T, TNumElements>::const_iterator MappedBuffer<T, TNumElements>::begin() const
+    {
+        return const_iterator(this->storage, this->Head());
+    }
+
+    template <typename T, size_t TNumElements>
+    typename MappedBuffer<T, TNumElements>::const_iterator MappedBuffer<T, TNumElements>::end() const
+    {
+        return const_iterator(this->storage, this->Head() + this->Size());
+    }
+
+    template <typename T, size_t TNumElements>
+    typename MappedBuffer<T, TNumElements>::const_iterator MappedBuffer<T, TNumElements>::cbegin() const
+    {
+        return this->begin();
+    }
+
+    template <typename T, size_t TNumElements>
+    typename MappedBuffer<T, TNumElements>::const_iterator MappedBuffer<T, TNumElements>::cend() const
+    {
+        return this->end();
+    }
+
+    template <typename T, size_t TNumElements>
+    bool MappedBuffer<T, TNumElements>::Validate(MappedBufferHeader &header)
+    {
+        if (header.end < header.begin)
+        {
+            // Can't tell which one is wrong, keep nothing.
+            header.begin = header.end;
+            return false;
+        }
+        if (header.end - header.begin > TNumElements)
+        {
+            // Keep the newest elements.
+            header.begin = header.end - TNumElements;
+            return false;
+        }
+        return true;
+    }
+
+    template <typename T, size_t TNumElements>
+    bool MappedBuffer<T, TNumElements>::CheckRegion(const void *region, size_t regionSize, MappedBufferStatus &problem)
+    {
+        if (region == nullptr || regionSize < kRegionSize)
+        {
+            problem = MappedBufferStatus::TOO_SMALL;
+            return false;
+        }
+        if (reinterpret_cast<uintptr_t>(region) % kRegionAlignment != 0)
+        {
+            problem = MappedBufferStatus::MISALIGNED;
+            return false;
+        }
+        return true;
+    }
+
+    template <typename T, size_t TNumElements>
+    void MappedBuffer<T, TNumElements>::Use(void *region)
+    {
+        this->header = static_cast<MappedBufferHeader *>(region);
+        this->storage = reinterpret_cast<T *>(static_cast<uint8_t *>(region) + kDataOffset);
+        this->headBegin = this->header->begin;
+        this->head = static_cast<size_t>(this->headBegin % TNumElements);
+    }
+} // namespace libEmbedded
+
+#endif // LIBEMBEDDED_MAPPED_BUFFER_H
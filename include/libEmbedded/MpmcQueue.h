@@ -0,0 +1,290 @@
+/**
+ * @file MpmcQueue.h
+ * @author Giel Willemsen
+ * @brief A lock-free queue of a static size for any number of producer and consumer threads.
+ * @version 0.1 2026-10-17 Initial version
+ * @version 0.2 2026-10-17 OverflowPolicy::BLOCK with a Push that waits (with a timeout) for a consumer to make room.
+ * @version 0.3 2026-10-17 TNumElements must be a power of two so the slot index survives the wrap of the positions.
+ * @version 0.4 2026-10-17 TryPush(T&&) and the elements are moved out of the queue, so move-only types can be queued.
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * @details
+ * Based on the bounded MPMC queue by Dmitry Vyukov. Every slot has its own sequence counter that tells
+ * if the slot is ready to be written (sequence == position) or to be read (sequence == position + 1).
+ * Producers only compete with other producers on the enqueue position and consumers only with other
+ * consumers on the dequeue position, a producer and a consumer never share a lock.
+ * Just like Buffer.h no heap memory is used, all the storage is part of the object itself.
+ * The positions are free-running and wrap around at the maximum of size_t (after 2^32 operations on a 32-bit
+ * target). Only with a power of two number of slots does the slot index stay continuous over that wrap, so other
+ * capacities are rejected at compile time. The differences between the positions and sequences are computed
+ * unsigned, so they also stay right over the wrap.
+ */
+#pragma once
+#ifndef LIBEMBEDDED_MPMC_QUEUE_H
+#define LIBEMBEDDED_MPMC_QUEUE_H
+#include <stddef.h>
+#include <atomic>
+#include <chrono>
+#include <new>
+#include "libEmbedded/TypeTrait.h"
+#include "libEmbedded/Helpers.h"
+#include "libEmbedded/OverflowPolicy.h"
+#include "libEmbedded/OverflowWaiter.h"
+
+namespace libEmbedded
+{
+    /**
+     * @brief Lock-free fixed size queue for multiple producers and multiple consumers.
+     * A push on a full queue fails instead of dropping elements.
+     *
+     * @tparam T The type of the element in the queue.
+     * @tparam TNumElements The maximum number of elements the queue can hold, must be a power of two.
+     * @tparam TOverflowPolicy REJECT (a push on a full queue fails) or BLOCK (Push can also wait for room).
+     */
+    template <typename T, size_t TNumElements, OverflowPolicy TOverflowPolicy = OverflowPolicy::REJECT>
+    class MpmcQueue
+    {
+        // With a single slot "filled in this round" and "free in the next round" would be the same sequence number.
+        static_assert(TNumElements > 1, "A MpmcQueue needs at least two slots.");
+        static_assert(IsPowerOfTwo(TNumElements), "The slot index of a MpmcQueue is only continuous over the wrap of the positions with a power of two TNumElements.");
+        static_assert(TOverflowPolicy != OverflowPolicy::DROP_OLDEST, "The consumers own the front of a MpmcQueue, so a producer can't drop the oldest element.");
+
+    private:
+        struct Slot
+        {
+            std::atomic<size_t> sequence;
+            typename aligned_storage<sizeof(T), alignof(T)>::type storage;
+        };
+
+        alignas(kCacheLineSize) std::atomic<size_t> enqueuePosition;
+        alignas(kCacheLineSize) std::atomic<size_t> dequeuePosition;
+        alignas(kCacheLineSize) Slot slots[TNumElements];
+
+        OverflowWaiter<TOverflowPolicy> waiter;
+
+    public:
+        /**
+         * @brief Construct a new empty queue.
+         *
+         */
+        MpmcQueue();
+
+        /**
+         * @brief The queue is shared between threads, so copying it makes no sense.
+         *
+         */
+        MpmcQueue(const MpmcQueue<T, TNumElements, TOverflowPolicy> &) = delete;
+
+        /**
+         * @brief The queue is shared between threads, so copying it makes no sense.
+         *
+         */
+        MpmcQueue<T, TNumElements, TOverflowPolicy> &operator=(const MpmcQueue<T, TNumElements, TOverflowPolicy> &) = delete;
+
+        /**
+         * @brief Destroy the queue and the elements that were never popped.
+         *
+         */
+        ~MpmcQueue();
+
+        /**
+         * @brief Add the element to the back of the queue. Can be called from any thread.
+         *
+         * @param element The element to add to the queue.
+         * @return true If the element was added.
+         * @return false If the queue was full and nothing was added.
+         */
+        bool TryPush(const T &element);
+
+        /**
+         * @brief Move the element to the back of the queue. Can be called from any thread.
+         *
+         * @param element The element to move into the queue, untouched when the queue was full.
+         * @return true If the element was added.
+         * @return false If the queue was full and nothing was added.
+         */
+        bool TryPush(T &&element);
+
+        /**
+         * @brief Add the element to the back of the queue, waiting for a consumer to make room if it is full. Can be called from any thread.
+         * Only available with OverflowPolicy::BLOCK, the consumers only pay for it when a producer is actually waiting.
+         *
+         * @tparam TRep The representation type of the timeout.
+         * @tparam TPeriod The period of the timeout.
+         * @param element The element to add to the queue.
+         * @param timeout The maximum time to wait for room.
+         * @return true If the element was added.
+         * @return false If the queue stayed full for the whole timeout, nothing was added.
+         */
+        template <typename TRep, typename TPeriod>
+        bool Push(const T &element, const std::chrono::duration<TRep, TPeriod> &timeout);
+
+        /**
+         * @brief Take the element at the front of the queue. Can be called from any thread.
+         *
+         * @param element Set to the element that was taken from the queue.
+         * @return true If a element was taken.
+         * @return false If the queue was empty, element is untouched.
+         */
+        bool TryPop(T &element);
+
+        /**
+         * @brief Returns the number of elements in the queue.
+         * When called while other threads are busy this is only a estimate.
+         *
+         * @return size_t The number of elements in the queue.
+         */
+        size_t Size() const;
+
+        /**
+         * @brief Returns the maximum number of elements that could possibly be in the queue.
+         *
+         * @return size_t The maximum number of elements possible in the queue.
+         */
+        size_t Capacity() const;
+
+    private:
+        template <typename TElement>
+        bool TryPushElement(TElement &&element);
+
+        T *GetItem(Slot &slot);
+    };
+
+    template <typename T, size_t TNumElements, OverflowPolicy TOverflowPolicy>
+    MpmcQueue<T, TNumElements, TOverflowPolicy>::MpmcQueue() : enqueuePosition(0), dequeuePosition(0)
+    {
+        for (size_t i = 0; i < TNumElements; i++)
+        {
+            this->slots[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    template <typename T, size_t TNumElements, OverflowPolicy TOverflowPolicy>
+    MpmcQueue<T, TNumElements, TOverflowPolicy>::~MpmcQueue()
+    {
+        const size_t end = this->enqueuePosition.load(std::memory_order_relaxed);
+        for (size_t position = this->dequeuePosition.load(std::memory_order_relaxed); position != end; position++)
+        {
+            this->GetItem(this->slots[position & (TNumElements - 1)])->~T();
+        }
+    }
+
+    template <typename T, size_t TNumElements, OverflowPolicy TOverflowPolicy>
+    bool MpmcQueue<T, TNumElements, TOverflowPolicy>::TryPush(const T &element)
+    {
+        return this->TryPushElement(element);
+    }
+
+    template <typename T, size_t TNumElements, OverflowPolicy TOverflowPolicy>
+    bool MpmcQueue<T, TNumElements, TOverflowPolicy>::TryPush(T &&element)
+    {
+        return this->TryPushElement(libEmbedded::move(element));
+    }
+
+    template <typename T, size_t TNumElements, OverflowPolicy TOverflowPolicy>
+    template <typename TElement>
+    bool MpmcQueue<T, TNumElements, TOverflowPolicy>::TryPushElement(TElement &&element)
+    {
+        size_t position = this->enqueuePosition.load(std::memory_order_relaxed);
+        Slot *slot = nullptr;
+        while (true)
+        {
+            slot = &this->slots[position & (TNumElements - 1)];
+            const size_t sequence = slot->sequence.load(std::memory_order_acquire);
+            const ptrdiff_t difference = static_cast<ptrdiff_t>(sequence - position);
+            if (difference == 0)
+            {
+                // Slot is free for this position, try to claim it.
+                if (this->enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (difference < 0)
+            {
+                // Slot still holds a element from the previous round, so the queue is full.
+                return false;
+            }
+            else
+            {
+                // Another producer claimed this position already.
+                position = this->enqueuePosition.load(std::memory_order_relaxed);
+            }
+        }
+        new (this->GetItem(*slot)) T(libEmbedded::forward<TElement>(element));
+        slot->sequence.store(position + 1, std::memory_order_release);
+        return true;
+    }
+
+    template <typename T, size_t TNumElements, OverflowPolicy TOverflowPolicy>
+    template <typename TRep, typename TPeriod>
+    bool MpmcQueue<T, TNumElements, TOverflowPolicy>::Push(const T &element, const std::chrono::duration<TRep, TPeriod> &timeout)
+    {
+        static_assert(TOverflowPolicy == OverflowPolicy::BLOCK, "Push with a timeout needs OverflowPolicy::BLOCK, use TryPush otherwise.");
+        return this->waiter.WaitFor([this, &element]() { return this->TryPush(element); }, timeout);
+    }
+
+    template <typename T, size_t TNumElements, OverflowPolicy TOverflowPolicy>
+    bool MpmcQueue<T, TNumElements, TOverflowPolicy>::TryPop(T &element)
+    {
+        size_t position = this->dequeuePosition.load(std::memory_order_relaxed);
+        Slot *slot = nullptr;
+        while (true)
+        {
+            slot = &this->slots[position & (TNumElements - 1)];
+            const size_t sequence = slot->sequence.load(std::memory_order_acquire);
+            const ptrdiff_t difference = static_cast<ptrdiff_t>(sequence - (position + 1));
+            if (difference == 0)
+            {
+                // Slot is filled for this position, try to claim it.
+                if (this->dequeuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (difference < 0)
+            {
+                // Slot not yet written for this position, so the queue is empty.
+                return false;
+            }
+            else
+            {
+                // Another consumer claimed this position already.
+                position = this->dequeuePosition.load(std::memory_order_relaxed);
+            }
+        }
+        T *item = this->GetItem(*slot);
+        element = libEmbedded::move(*item);
+        item->~T();
+        // Mark the slot free for the producer of the next round.
+        slot->sequence.store(position + TNumElements, std::memory_order_release);
+        this->waiter.NotifySpaceFreed();
+        return true;
+    }
+
+    template <typename T, size_t TNumElements, OverflowPolicy TOverflowPolicy>
+    size_t MpmcQueue<T, TNumElements, TOverflowPolicy>::Size() const
+    {
+        const size_t dequeued = this->dequeuePosition.load(std::memory_order_relaxed);
+        const size_t enqueued = this->enqueuePosition.load(std::memory_order_relaxed);
+        // dequeued is loaded first so it is never passed enqueued, the unsigned difference stays right over the wrap.
+        const size_t used = enqueued - dequeued;
+        return used > TNumElements ? TNumElements : used;
+    }
+
+    template <typename T, size_t TNumElements, OverflowPolicy TOverflowPolicy>
+    size_t MpmcQueue<T, TNumElements, TOverflowPolicy>::Capacity() const
+    {
+        return TNumElements;
+    }
+
+    template <typename T, size_t TNumElements, OverflowPolicy TOverflowPolicy>
+    T *MpmcQueue<T, TNumElements, TOverflowPolicy>::GetItem(Slot &slot)
+    {
+        return reinterpret_cast<T *>(slot.storage.data);
+    }
+} // namespace libEmbedded
+
+#endif // LIBEMBEDDED_MPMC_QUEUE_H
@@ -0,0 +1,41 @@
+/**
+ * @file OverflowPolicy.h
+ * @author Giel Willemsen
+ * @brief The different ways a fixed size container can handle a add when it is full.
+ * @version 0.1 2026-10-17 Initial version
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#pragma once
+#ifndef LIBEMBEDDED_OVERFLOW_POLICY_H
+#define LIBEMBEDDED_OVERFLOW_POLICY_H
+
+namespace libEmbedded
+{
+    /**
+     * @brief What a fixed size container does with a new element when it is full.
+     * Used as template parameter so the choice is made at compile time.
+     *
+     */
+    enum class OverflowPolicy
+    {
+        /**
+         * @brief Drop the oldest element(s) to make room for the new one(s).
+         */
+        DROP_OLDEST,
+
+        /**
+         * @brief Don't add the new element(s) and report this to the caller.
+         */
+        REJECT,
+
+        /**
+         * @brief Wait (up to a timeout) until another thread made room. Only for the concurrent containers.
+         */
+        BLOCK
+    };
+} // namespace libEmbedded
+
+#endif // LIBEMBEDDED_OVERFLOW_POLICY_H
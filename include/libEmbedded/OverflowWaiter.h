@@ -0,0 +1,113 @@
+/**
+ * @file OverflowWaiter.h
+ * @author Giel Willemsen
+ * @brief Lets a producer of a concurrent queue wait until a consumer made room.
+ * @version 0.1 2026-10-17 Initial version
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * @details
+ * Only the OverflowPolicy::BLOCK specialization has any state, for the other policies the waiter is a
+ * empty type with a empty NotifySpaceFreed so the consumer fast path stays exactly the same.
+ * With BLOCK the consumer only takes the mutex when a producer is actually waiting.
+ */
+#pragma once
+#ifndef LIBEMBEDDED_OVERFLOW_WAITER_H
+#define LIBEMBEDDED_OVERFLOW_WAITER_H
+#include <stddef.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include "libEmbedded/OverflowPolicy.h"
+
+namespace libEmbedded
+{
+    /**
+     * @brief Waiter for the policies that never wait, does nothing.
+     *
+     * @tparam TOverflowPolicy The overflow policy of the queue.
+     */
+    template <OverflowPolicy TOverflowPolicy>
+    class OverflowWaiter
+    {
+    public:
+        /**
+         * @brief Called by the consumer after it freed a slot.
+         *
+         */
+        void NotifySpaceFreed()
+        {
+        }
+    };
+
+    /**
+     * @brief Waiter for OverflowPolicy::BLOCK, producers sleep on a condition variable until space is freed.
+     *
+     */
+    template <>
+    class OverflowWaiter<OverflowPolicy::BLOCK>
+    {
+    private:
+        std::mutex lock;
+        std::condition_variable spaceFreed;
+        std::atomic<size_t> waiting;
+
+    public:
+        OverflowWaiter() : waiting(0) {}
+
+        /**
+         * @brief Keep calling tryAdd until it succeeds or the timeout expires.
+         *
+         * @tparam TTryAdd The type of the callable that tries to add the element.
+         * @tparam TRep The representation type of the timeout.
+         * @tparam TPeriod The period of the timeout.
+         * @param tryAdd Called to try to add the element, returns true when it was added.
+         * @param timeout The maximum time to wait for space.
+         * @return true If tryAdd succeeded.
+         * @return false If the timeout expired before tryAdd succeeded.
+         */
+        template <typename TTryAdd, typename TRep, typename TPeriod>
+        bool WaitFor(TTryAdd tryAdd, const std::chrono::duration<TRep, TPeriod> &timeout)
+        {
+            if (tryAdd())
+            {
+                return true;
+            }
+            const std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now() + timeout;
+            std::unique_lock<std::mutex> guard(this->lock);
+            this->waiting.fetch_add(1, std::memory_order_relaxed);
+            // Pairs with the fence in NotifySpaceFreed: either the consumer sees us waiting or we see the freed slot.
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            bool added = tryAdd();
+            while (!added)
+            {
+                if (this->spaceFreed.wait_until(guard, deadline) == std::cv_status::timeout)
+                {
+                    added = tryAdd();
+                    break;
+                }
+                added = tryAdd();
+            }
+            this->waiting.fetch_sub(1, std::memory_order_relaxed);
+            return added;
+        }
+
+        /**
+         * @brief Called by the consumer after it freed a slot, wakes up the waiting producers (if any).
+         *
+         */
+        void NotifySpaceFreed()
+        {
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (this->waiting.load(std::memory_order_relaxed) > 0)
+            {
+                std::lock_guard<std::mutex> guard(this->lock);
+                this->spaceFreed.notify_all();
+            }
+        }
+    };
+} // namespace libEmbedded
+
+#endif // LIBEMBEDDED_OVERFLOW_WAITER_H
@@ -0,0 +1,194 @@
+/**
+ * @file SeqlockBuffer.h
+ * @author Giel Willemsen
+ * @brief A Buffer with one writer that never blocks and readers that take consistent snapshots (seqlock).
+ * @version 0.1 2026-10-17 Initial version
+ * @version 0.2 2026-10-17 Snapshots copy the fields of the Buffer instead of the whole (not trivially copyable) Buffer object.
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * @details
+ * The writer makes the sequence number odd before it changes the buffer and even again afterwards.
+ * A reader copies the whole buffer and only accepts the copy when the sequence number was even and did not change
+ * while copying, otherwise it copies again. The writer never waits for a reader, a reader that keeps losing the race
+ * against a very busy writer keeps retrying. Meant for small buffers, every read copies the complete workspace.
+ * The copy races with the writer by design (it is thrown away when it might be torn), which is why only trivially
+ * copyable and trivially destructible T are allowed: the state of such a Buffer is nothing more than its bytes.
+ */
+#pragma once
+#ifndef LIBEMBEDDED_SEQLOCK_BUFFER_H
+#define LIBEMBEDDED_SEQLOCK_BUFFER_H
+#include <stddef.h>
+#include <atomic>
+#include <thread>
+#include "libEmbedded/TypeTrait.h"
+#include "libEmbedded/Helpers.h"
+#include "libEmbedded/Buffer.h"
+
+namespace libEmbedded
+{
+    /**
+     * @brief Buffer for a single writer thread that can be copied at any moment by any number of reader threads.
+     *
+     * @tparam T The type of the element in the buffer.
+     * @tparam TNumElements The maximum number of elements in the buffer.
+     */
+    template <typename T, size_t TNumElements>
+    class SeqlockBuffer
+    {
+        static_assert(libEmbedded::is_trivially_copyable<T>::value && libEmbedded::is_trivially_destructible<T>::value,
+                      "A SeqlockBuffer is copied byte for byte while it may be changing, T must be trivially copyable and destructible.");
+
+    public:
+        typedef Buffer<T, TNumElements> BufferType;
+
+    private:
+        alignas(kCacheLineSize) std::atomic<size_t> sequence;
+        BufferType buffer;
+
+    public:
+        /**
+         * @brief Construct a new empty buffer.
+         *
+         */
+        SeqlockBuffer() : sequence(0), buffer() {}
+
+        /**
+         * @brief The buffer is shared between threads, so copying it makes no sense (use Read for a copy of the contents).
+         *
+         */
+        SeqlockBuffer(const SeqlockBuffer<T, TNumElements> &) = delete;
+
+        /**
+         * @brief The buffer is shared between threads, so copying it makes no sense (use Read for a copy of the contents).
+         *
+         */
+        SeqlockBuffer<T, TNumElements> &operator=(const SeqlockBuffer<T, TNumElements> &) = delete;
+
+        /**
+         * @brief Adds the given element to the back of the buffer, poping at the beginning if necessary. Writer thread only.
+         *
+         * @param element The element to add to the buffer.
+         */
+        void Add(const T &element);
+
+        /**
+         * @brief Adds the given elements to the back of the buffer, poping at the beginning if necessary. Writer thread only.
+         * Readers see either none or all of the elements.
+         *
+         * @param elements The elements to add to the buffer.
+         * @param elementCount The number of elements to add to the buffer.
+         */
+        void AddRange(const T *elements, size_t elementCount);
+
+        /**
+         * @brief Remove count elements from the beginning of the buffer. Writer thread only.
+         *
+         * @param count The number of elements to remove.
+         */
+        void Remove(size_t count);
+
+        /**
+         * @brief Access the buffer from the writer thread, other threads have to use Read.
+         *
+         * @return const BufferType& The buffer.
+         */
+        const BufferType &GetBuffer() const;
+
+        /**
+         * @brief Try once to copy the contents of the buffer. Can be called from any thread.
+         *
+         * @param snapshot Set to the contents of the buffer when successful.
+         * @return true If snapshot holds a consistent copy.
+         * @return false If the writer was busy, snapshot holds garbage.
+         */
+        bool TryRead(BufferType &snapshot) const;
+
+        /**
+         * @brief Copy the contents of the buffer, retrying until the copy is consistent. Can be called from any thread.
+         *
+         * @param snapshot Set to the contents of the buffer.
+         */
+        void Read(BufferType &snapshot) const;
+
+    private:
+        size_t BeginWrite();
+
+        void EndWrite(size_t started);
+    };
+
+    template <typename T, size_t TNumElements>
+    void SeqlockBuffer<T, TNumElements>::Add(const T &element)
+    {
+        const size_t started = this->BeginWrite();
+        this->buffer.Add(element);
+        this->EndWrite(started);
+    }
+
+    template <typename T, size_t TNumElements>
+    void SeqlockBuffer<T, TNumElements>::AddRange(const T *elements, size_t elementCount)
+    {
+        const size_t started = this->BeginWrite();
+        this->buffer.AddRange(elements, elementCount);
+        this->EndWrite(started);
+    }
+
+    template <typename T, size_t TNumElements>
+    void SeqlockBuffer<T, TNumElements>::Remove(size_t count)
+    {
+        const size_t started = this->BeginWrite();
+        this->buffer.Remove(count);
+        this->EndWrite(started);
+    }
+
+    template <typename T, size_t TNumElements>
+    const typename SeqlockBuffer<T, TNumElements>::BufferType &SeqlockBuffer<T, TNumElements>::GetBuffer() const
+    {
+        return this->buffer;
+    }
+
+    template <typename T, size_t TNumElements>
+    bool SeqlockBuffer<T, TNumElements>::TryRead(BufferType &snapshot) const
+    {
+        const size_t before = this->sequence.load(std::memory_order_acquire);
+        if ((before & 1) != 0)
+        {
+            // The writer is busy.
+            return false;
+        }
+        snapshot.RawCopyFrom(this->buffer);
+        // Keep the copy before the second load of the sequence number.
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return this->sequence.load(std::memory_order_relaxed) == before;
+    }
+
+    template <typename T, size_t TNumElements>
+    void SeqlockBuffer<T, TNumElements>::Read(BufferType &snapshot) const
+    {
+        while (!this->TryRead(snapshot))
+        {
+            // Give a preempted writer the chance to finish.
+            std::this_thread::yield();
+        }
+    }
+
+    template <typename T, size_t TNumElements>
+    size_t SeqlockBuffer<T, TNumElements>::BeginWrite()
+    {
+        // Only the writer changes the sequence number, no read-modify-write needed.
+        const size_t started = this->sequence.load(std::memory_order_relaxed);
+        this->sequence.store(started + 1, std::memory_order_relaxed);
+        // Keep the changes to the buffer after the odd sequence number.
+        std::atomic_thread_fence(std::memory_order_release);
+        return started;
+    }
+
+    template <typename T, size_t TNumElements>
+    void SeqlockBuffer<T, TNumElements>::EndWrite(size_t started)
+    {
+        this->sequence.store(started + 2, std::memory_order_release);
+    }
+} // namespace libEmbedded
+
+#endif // LIBEMBEDDED_SEQLOCK_BUFFER_H
@@ -0,0 +1,303 @@
+/**
+ * @file SlidingWindow.h
+ * @author Giel Willemsen
+ * @brief A Buffer of the last samples that keeps the sum, mean, variance, min and max up to date in O(1) (amortized).
+ * @version 0.1 2026-10-17 Initial version
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * @details
+ * The window owns its Buffer, so every element that leaves the buffer (dropped by Add on a full window or taken
+ * out with Remove) passes through the window and is taken out of the aggregates at the same time.
+ * The sum and the sum of squares are kept as running sums. The min and max each use a monotonic queue of sample
+ * numbers, a newer sample that is smaller (or larger) than older ones makes those older ones irrelevant so they
+ * are popped from the back, and the front is the current min (or max). Every sample is pushed and popped at most
+ * once, so the cost per Add is amortized constant.
+ */
+#pragma once
+#ifndef LIBEMBEDDED_SLIDING_WINDOW_H
+#define LIBEMBEDDED_SLIDING_WINDOW_H
+#include <stddef.h>
+#include "libEmbedded/Buffer.h"
+
+namespace libEmbedded
+{
+    /**
+     * @brief Fixed size window over the last samples with incremental aggregates.
+     * NOTE: With a floating point accumulator and non integer samples the running sums slowly collect rounding
+     * errors, integer samples are exact as long as the sums fit in the mantissa. Use a integer TAccumulator
+     * (for example int64_t) for integer samples to never lose precision.
+     *
+     * @tparam T The type of the samples, a arithmetic type.
+     * @tparam TNumElements The number of samples in the window.
+     * @tparam TAccumulator The type the sum and the sum of squares are kept in.
+     */
+    template <typename T, size_t TNumElements, typename TAccumulator = double>
+    class SlidingWindow
+    {
+    private:
+        /**
+         * @brief Queue of sample numbers that can be popped from both ends, there is at most one entry per sample in the window.
+         *
+         */
+        class SequenceQueue
+        {
+        private:
+            size_t sequences[TNumElements];
+            size_t head;
+            size_t count;
+
+        public:
+            SequenceQueue() : head(0), count(0) {}
+
+            bool IsEmpty() const
+            {
+                return this->count == 0;
+            }
+
+            size_t Front() const
+            {
+                return this->sequences[this->head];
+            }
+
+            size_t Back() const
+            {
+                return this->sequences[Wrap(this->head + this->count - 1)];
+            }
+
+            void PushBack(size_t sequence)
+            {
+                this->sequences[Wrap(this->head + this->count)] = sequence;
+                this->count++;
+            }
+
+            void PopBack()
+            {
+                this->count--;
+            }
+
+            void PopFront()
+            {
+                this->head = Wrap(this->head + 1);
+                this->count--;
+            }
+
+        private:
+            static constexpr size_t Wrap(size_t index)
+            {
+                return BufferIndex<TNumElements>::Wrap(index);
+            }
+        };
+
+        Buffer<T, TNumElements> window;
+        // Sample number of the oldest element in the window, sample numbers may wrap around.
+        size_t firstSequence;
+        TAccumulator sum;
+        TAccumulator sumOfSquares;
+        SequenceQueue minQueue;
+        SequenceQueue maxQueue;
+
+    public:
+        /**
+         * @brief Construct a new empty window.
+         *
+         */
+        SlidingWindow() : window(), firstSequence(0), sum(0), sumOfSquares(0), minQueue(), maxQueue() {}
+
+        /**
+         * @brief Add a sample to the window, dropping the oldest sample if the window is full.
+         *
+         * @param value The sample to add.
+         */
+        void Add(const T &value);
+
+        /**
+         * @brief Remove the oldest samples from the window.
+         *
+         * @param count The number of samples to remove, clamped to the Size.
+         */
+        void Remove(size_t count);
+
+        /**
+         * @brief Returns the number of samples in the window.
+         *
+         * @return size_t The number of samples in the window.
+         */
+        size_t Size() const;
+
+        /**
+         * @brief Returns the maximum number of samples in the window.
+         *
+         * @return size_t The maximum number of samples in the window.
+         */
+        size_t Capacity() const;
+
+        /**
+         * @brief Returns the sum of the samples in the window.
+         *
+         * @return TAccumulator The sum of the samples, 0 for a empty window.
+         */
+        TAccumulator Sum() const;
+
+        /**
+         * @brief Returns the mean of the samples in the window.
+         *
+         * @return double The mean of the samples, 0 for a empty window.
+         */
+        double Mean() const;
+
+        /**
+         * @brief Returns the (population) variance of the samples in the window.
+         *
+         * @return double The variance of the samples, 0 for a empty window.
+         */
+        double Variance() const;
+
+        /**
+         * @brief Returns the smallest sample in the window.
+         * Warning: The window may not be empty!
+         *
+         * @return const T& The smallest sample.
+         */
+        const T &Min() const;
+
+        /**
+         * @brief Returns the largest sample in the window.
+         * Warning: The window may not be empty!
+         *
+         * @return const T& The largest sample.
+         */
+        const T &Max() const;
+
+        /**
+         * @brief Returns the samples in the window, oldest first.
+         *
+         * @return const Buffer<T, TNumElements>& The buffer with the samples.
+         */
+        const Buffer<T, TNumElements> &GetBuffer() const;
+
+    private:
+        const T &GetSample(size_t sequence) const
+        {
+            return this->window[sequence - this->firstSequence];
+        }
+
+        void Evict(size_t count);
+    };
+
+    template <typename T, size_t TNumElements, typename TAccumulator>
+    void SlidingWindow<T, TNumElements, TAccumulator>::Add(const T &value)
+    {
+        if (this->window.Size() == TNumElements)
+        {
+            this->Evict(1);
+        }
+        const size_t sequence = this->firstSequence + this->window.Size();
+        this->window.Add(value);
+        const TAccumulator accumulated = static_cast<TAccumulator>(value);
+        this->sum += accumulated;
+        this->sumOfSquares += accumulated * accumulated;
+        // Older samples that are not smaller (or larger) than the new one can never be the min (or max) again.
+        while (!this->minQueue.IsEmpty() && !(this->GetSample(this->minQueue.Back()) < value))
+        {
+            this->minQueue.PopBack();
+        }
+        this->minQueue.PushBack(sequence);
+        while (!this->maxQueue.IsEmpty() && !(value < this->GetSample(this->maxQueue.Back())))
+        {
+            this->maxQueue.PopBack();
+        }
+        this->maxQueue.PushBack(sequence);
+    }
+
+    template <typename T, size_t TNumElements, typename TAccumulator>
+    void SlidingWindow<T, TNumElements, TAccumulator>::Remove(size_t count)
+    {
+        this->Evict(count > this->window.Size() ? this->window.Size() : count);
+    }
+
+    template <typename T, size_t TNumElements, typename TAccumulator>
+    size_t SlidingWindow<T, TNumElements, TAccumulator>::Size() const
+    {
+        return this->window.Size();
+    }
+
+    template <typename T, size_t TNumElements, typename TAccumulator>
+    size_t SlidingWindow<T, TNumElements, TAccumulator>::Capacity() const
+    {
+        return TNumElements;
+    }
+
+    template <typename T, size_t TNumElements, typename TAccumulator>
+    TAccumulator SlidingWindow<T, TNumElements, TAccumulator>::Sum() const
+    {
+        return this->sum;
+    }
+
+    template <typename T, size_t TNumElements, typename TAccumulator>
+    double SlidingWindow<T, TNumElements, TAccumulator>::Mean() const
+    {
+        if (this->window.Size() == 0)
+        {
+            return 0;
+        }
+        return static_cast<double>(this->sum) / static_cast<double>(this->window.Size());
+    }
+
+    template <typename T, size_t TNumElements, typename TAccumulator>
+    double SlidingWindow<T, TNumElements, TAccumulator>::Variance() const
+    {
+        if (this->window.Size() == 0)
+        {
+            return 0;
+        }
+        const double size = static_cast<double>(this->window.Size());
+        const double mean = static_cast<double>(this->sum) / size;
+        const double variance = static_cast<double>(this->sumOfSquares) / size - mean * mean;
+        // Rounding can make a (near) zero variance slightly negative.
+        return variance < 0 ? 0 : variance;
+    }
+
+    template <typename T, size_t TNumElements, typename TAccumulator>
+    const T &SlidingWindow<T, TNumElements, TAccumulator>::Min() const
+    {
+        return this->GetSample(this->minQueue.Front());
+    }
+
+    template <typename T, size_t TNumElements, typename TAccumulator>
+    const T &SlidingWindow<T, TNumElements, TAccumulator>::Max() const
+    {
+        return this->GetSample(this->maxQueue.Front());
+    }
+
+    template <typename T, size_t TNumElements, typename TAccumulator>
+    const Buffer<T, TNumElements> &SlidingWindow<T, TNumElements, TAccumulator>::GetBuffer() const
+    {
+        return this->window;
+    }
+
+    template <typename T, size_t TNumElements, typename TAccumulator>
+    void SlidingWindow<T, TNumElements, TAccumulator>::Evict(size_t count)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            const TAccumulator accumulated = static_cast<TAccumulator>(this->window[i]);
+            this->sum -= accumulated;
+            this->sumOfSquares -= accumulated * accumulated;
+            const size_t sequence = this->firstSequence + i;
+            if (!this->minQueue.IsEmpty() && this->minQueue.Front() == sequence)
+            {
+                this->minQueue.PopFront();
+            }
+            if (!this->maxQueue.IsEmpty() && this->maxQueue.Front() == sequence)
+            {
+                this->maxQueue.PopFront();
+            }
+        }
+        this->window.Remove(count);
+        this->firstSequence += count;
+    }
+} // namespace libEmbedded
+
+#endif // LIBEMBEDDED_SLIDING_WINDOW_H
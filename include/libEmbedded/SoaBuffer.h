@@ -0,0 +1,336 @@
+/**
+ * @file SoaBuffer.h
+ * @author Giel Willemsen
+ * @brief A rotating buffer of records that stores every field in its own column (struct of arrays).
+ * @version 0.1 2026-10-17 Initial version
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * @details
+ * A Buffer<Record> stores whole records after each other, so a loop over one field strides over all other fields.
+ * The SoaBuffer stores the records as TFields... columns instead, all with the same head and size, so the values of
+ * one field are next to each other and a loop over them can be vectorized. Like a Buffer the columns are rings,
+ * GetColumn returns the (at most) two segments of a column. Linearize moves the oldest record to the start of every
+ * column, after which the first segment of each column holds everything.
+ */
+#pragma once
+#ifndef LIBEMBEDDED_SOA_BUFFER_H
+#define LIBEMBEDDED_SOA_BUFFER_H
+#include <stddef.h>
+#include "libEmbedded/TypeTrait.h"
+#include "libEmbedded/TemplateUtil.h"
+#include "libEmbedded/Span.h"
+#include "libEmbedded/Buffer.h"
+
+namespace libEmbedded
+{
+    template <size_t TNumElements, typename... TFields>
+    class SoaColumns;
+
+    /**
+     * @brief The end of the columns of a SoaBuffer.
+     *
+     */
+    template <size_t TNumElements>
+    class SoaColumns<TNumElements>
+    {
+    public:
+        void Set(size_t) {}
+
+        void RotateLeft(size_t) {}
+    };
+
+    /**
+     * @brief The column of a field of a SoaBuffer followed by the columns of the other fields.
+     *
+     */
+    template <size_t TNumElements, typename TField, typename... TRest>
+    class SoaColumns<TNumElements, TField, TRest...>
+    {
+    private:
+        TField column[TNumElements];
+        SoaColumns<TNumElements, TRest...> rest;
+
+    public:
+        void Set(size_t slot, const TField &value, const TRest &...others)
+        {
+            this->column[slot] = value;
+            this->rest.Set(slot, others...);
+        }
+
+        /**
+         * @brief Rotate all columns so that the element in the given slot ends up in slot 0.
+         *
+         */
+        void RotateLeft(size_t slot)
+        {
+            // Reversing both parts and then the whole column rotates it without any extra storage.
+            Reverse(0, slot);
+            Reverse(slot, TNumElements);
+            Reverse(0, TNumElements);
+            this->rest.RotateLeft(slot);
+        }
+
+        TField *GetColumn(integral_constant<size_t, 0>)
+        {
+            return this->column;
+        }
+
+        const TField *GetColumn(integral_constant<size_t, 0>) const
+        {
+            return this->column;
+        }
+
+        template <size_t TIndex>
+        typename templateUtil::At<TIndex, TField, TRest...>::Type *GetColumn(integral_constant<size_t, TIndex>)
+        {
+            return this->rest.GetColumn(integral_constant<size_t, TIndex - 1>());
+        }
+
+        template <size_t TIndex>
+        const typename templateUtil::At<TIndex, TField, TRest...>::Type *GetColumn(integral_constant<size_t, TIndex>) const
+        {
+            return this->rest.GetColumn(integral_constant<size_t, TIndex - 1>());
+        }
+
+    private:
+        void Reverse(size_t begin, size_t end)
+        {
+            while (begin + 1 < end)
+            {
+                end--;
+                TField temporary = this->column[begin];
+                this->column[begin] = this->column[end];
+                this->column[end] = temporary;
+                begin++;
+            }
+        }
+    };
+
+    /**
+     * @brief Rotating buffer of records stored as one column per field, dropping the oldest record when it is full.
+     * NOTE: Every column is a plain array, so the fields must be default constructible and copy assignable, and all
+     * TNumElements slots are constructed up front (a removed record is not destructed, just overwritten later).
+     *
+     * @tparam TNumElements The maximum number of records in the buffer.
+     * @tparam TFields The types of the fields of a record, field I is accessed with GetColumn<I> and Get<I>.
+     */
+    template <size_t TNumElements, typename... TFields>
+    class SoaBuffer
+    {
+        static_assert(TNumElements > 0, "A SoaBuffer needs at least one element.");
+        static_assert(sizeof...(TFields) > 0, "A SoaBuffer needs at least one field.");
+
+    public:
+        /**
+         * @brief The type of field TIndex.
+         *
+         */
+        template <size_t TIndex>
+        using FieldType = typename templateUtil::At<TIndex, TFields...>::Type;
+
+        /**
+         * @brief The number of fields in a record.
+         *
+         */
+        static constexpr size_t kFieldCount = sizeof...(TFields);
+
+    private:
+        SoaColumns<TNumElements, TFields...> columns;
+        // Slot in the columns of the oldest record.
+        size_t head;
+        size_t elementsUsed;
+
+    public:
+        /**
+         * @brief Construct a new empty buffer.
+         *
+         */
+        SoaBuffer() : columns(), head(0), elementsUsed(0) {}
+
+        /**
+         * @brief Adds a record to the back of the buffer, dropping the oldest record if the buffer is full.
+         *
+         * @param values The value of every field of the record.
+         */
+        void Add(const TFields &...values);
+
+        /**
+         * @brief Remove count records from the beginning of the buffer.
+         *
+         * @param count The number of records to remove, clamped to the Size.
+         */
+        void Remove(size_t count);
+
+        /**
+         * @brief Remove all records.
+         *
+         */
+        void Clear();
+
+        /**
+         * @brief Returns the number of records in the buffer.
+         *
+         * @return size_t The number of records in the buffer.
+         */
+        size_t Size() const;
+
+        /**
+         * @brief Returns the maximum number of records in the buffer.
+         *
+         * @return size_t The maximum number of records in the buffer.
+         */
+        size_t Capacity() const;
+
+        /**
+         * @brief Retrieve a field of a record. Does not do any bounds checks!
+         *
+         * @tparam TIndex The index of the field.
+         * @param index The index of the record, 0 is the oldest.
+         * @return FieldType<TIndex>& The field.
+         */
+        template <size_t TIndex>
+        FieldType<TIndex> &Get(size_t index);
+
+        /**
+         * @brief Retrieve a field of a record. Does not do any bounds checks!
+         *
+         * @tparam TIndex The index of the field.
+         * @param index The index of the record, 0 is the oldest.
+         * @return const FieldType<TIndex>& The field.
+         */
+        template <size_t TIndex>
+        const FieldType<TIndex> &Get(size_t index) const;
+
+        /**
+         * @brief Retrieve all values of one field, oldest first.
+         *
+         * @tparam TIndex The index of the field.
+         * @return BufferSegments<FieldType<TIndex>> The values, two segments if they wrap around the end of the column.
+         */
+        template <size_t TIndex>
+        BufferSegments<FieldType<TIndex>> GetColumn();
+
+        /**
+         * @brief Retrieve all values of one field, oldest first.
+         *
+         * @tparam TIndex The index of the field.
+         * @return BufferSegments<const FieldType<TIndex>> The values, two segments if they wrap around the end of the column.
+         */
+        template <size_t TIndex>
+        BufferSegments<const FieldType<TIndex>> GetColumn() const;
+
+        /**
+         * @brief Move the records so the oldest one is at the start of the columns, afterwards the first segment
+         * returned by GetColumn holds all values (until a Add wraps around again). O(TNumElements) per field, nothing
+         * is moved when the buffer already starts at the beginning of the columns.
+         *
+         */
+        void Linearize();
+
+    private:
+        static constexpr size_t Wrap(size_t index)
+        {
+            return BufferIndex<TNumElements>::Wrap(index);
+        }
+
+        template <typename T>
+        BufferSegments<T> GetSegments(T *column) const;
+    };
+
+    template <size_t TNumElements, typename... TFields>
+    void SoaBuffer<TNumElements, TFields...>::Add(const TFields &...values)
+    {
+        if (this->elementsUsed == TNumElements)
+        {
+            this->head = Wrap(this->head + 1);
+            this->elementsUsed--;
+        }
+        this->columns.Set(Wrap(this->head + this->elementsUsed), values...);
+        this->elementsUsed++;
+    }
+
+    template <size_t TNumElements, typename... TFields>
+    void SoaBuffer<TNumElements, TFields...>::Remove(size_t count)
+    {
+        if (count >= this->elementsUsed)
+        {
+            this->Clear();
+            return;
+        }
+        this->head = Wrap(this->head + count);
+        this->elementsUsed -= count;
+    }
+
+    template <size_t TNumElements, typename... TFields>
+    void SoaBuffer<TNumElements, TFields...>::Clear()
+    {
+        this->head = 0;
+        this->elementsUsed = 0;
+    }
+
+    template <size_t TNumElements, typename... TFields>
+    size_t SoaBuffer<TNumElements, TFields...>::Size() const
+    {
+        return this->elementsUsed;
+    }
+
+    template <size_t TNumElements, typename... TFields>
+    size_t SoaBuffer<TNumElements, TFields...>::Capacity() const
+    {
+        return TNumElements;
+    }
+
+    template <size_t TNumElements, typename... TFields>
+    template <size_t TIndex>
+    typename SoaBuffer<TNumElements, TFields...>::template FieldType<TIndex> &SoaBuffer<TNumElements, TFields...>::Get(size_t index)
+    {
+        return this->columns.GetColumn(integral_constant<size_t, TIndex>())[Wrap(this->head + index)];
+    }
+
+    template <size_t TNumElements, typename... TFields>
+    template <size_t TIndex>
+    const typename SoaBuffer<TNumElements, TFields...>::template FieldType<TIndex> &SoaBuffer<TNumElements, TFields...>::Get(size_t index) const
+    {
+        return this->columns.GetColumn(integral_constant<size_t, TIndex>())[Wrap(this->head + index)];
+    }
+
+    template <size_t TNumElements, typename... TFields>
+    template <size_t TIndex>
+    BufferSegments<typename SoaBuffer<TNumElements, TFields...>::template FieldType<TIndex>> SoaBuffer<TNumElements, TFields...>::GetColumn()
+    {
+        static_assert(TIndex < sizeof...(TFields), "TIndex must be smaller than the number of fields.");
+        return this->GetSegments(this->columns.GetColumn(integral_constant<size_t, TIndex>()));
+    }
+
+    template <size_t TNumElements, typename... TFields>
+    template <size_t TIndex>
+    BufferSegments<const typename SoaBuffer<TNumElements, TFields...>::template FieldType<TIndex>> SoaBuffer<TNumElements, TFields...>::GetColumn() const
+    {
+        static_assert(TIndex < sizeof...(TFields), "TIndex must be smaller than the number of fields.");
+        return this->GetSegments(this->columns.GetColumn(integral_constant<size_t, TIndex>()));
+    }
+
+    template <size_t TNumElements, typename... TFields>
+    void SoaBuffer<TNumElements, TFields...>::Linearize()
+    {
+        if (this->head == 0)
+        {
+            return;
+        }
+        this->columns.RotateLeft(this->head);
+        this->head = 0;
+    }
+
+    template <size_t TNumElements, typename... TFields>
+    template <typename T>
+    BufferSegments<T> SoaBuffer<TNumElements, TFields...>::GetSegments(T *column) const
+    {
+        const size_t firstLength = TNumElements - this->head < this->elementsUsed ? TNumElements - this->head : this->elementsUsed;
+        BufferSegments<T> segments = {Span<T>(column + this->head, firstLength), Span<T>(column, this->elementsUsed - firstLength)};
+        return segments;
+    }
+} // namespace libEmbedded
+
+#endif // LIBEMBEDDED_SOA_BUFFER_H
@@ -15,7 +15,10 @@
  * @version 0.11 2022-06-09 Distance, Next and Prev are now single statement constexpr functions (but they are recursive now) for stricter C++11 compliance.
  * @version 0.12 2022-06-14 Moved iterator helpers to own Iterator.h file.
  * @version 0.13 2022-10-24 Implicit conversion from non-const to const is now possible with new TypeTrait helpers.
- * @date 2022-10-24
+ * @version 0.14 2026-10-17 Index operators are O(1) for pointers and random access iterators.
+ * @version 0.15 2026-10-17 Addition of slicing: Subspan, First, Last, SplitAt and Chunks. Const iterator getters are constexpr.
+ * @version 0.16 2026-10-17 Const index operators are constexpr.
+ * @date 2026-10-17
  *
  * @copyright Copyright (c) 2022
  *
@@ -27,9 +30,147 @@
 #include <stddef.h>
 #include "math.h"
 #include "libEmbedded/TypeTrait.h"
+#include "libEmbedded/Iterator.h"
 
 namespace libEmbedded
 {
+    /**
+     * @brief The two halves of a span that was split with SplitAt.
+     *
+     * @tparam TSpan The type of the span that was split.
+     */
+    template <typename TSpan>
+    struct SpanSplit
+    {
+        TSpan first;
+        TSpan second;
+    };
+
+    /**
+     * @brief Range over consecutive sub-spans of a fixed size, the last chunk holds the remainder (so it can be shorter).
+     * Created by Span::Chunks, nothing is copied.
+     *
+     * @tparam TSpan The type of the span that is chunked.
+     */
+    template <typename TSpan>
+    class SpanChunks
+    {
+    public:
+        using span_iterator = typename TSpan::iterator;
+
+        /**
+         * @brief Iterator that yields the chunks as spans.
+         *
+         */
+        class Iterator
+        {
+        private:
+            span_iterator chunkStart;
+            span_iterator chunkEnd;
+            span_iterator spanEnd;
+            size_t chunkSize;
+
+        public:
+            Iterator(span_iterator start, span_iterator end, size_t chunkSize) : chunkStart(start), chunkEnd(SpanChunks::ChunkEnd(start, end, chunkSize)), spanEnd(end), chunkSize(chunkSize) {}
+
+            TSpan operator*() const
+            {
+                return TSpan(this->chunkStart, this->chunkEnd);
+            }
+
+            Iterator &operator++()
+            {
+                this->chunkStart = this->chunkEnd;
+                this->chunkEnd = SpanChunks::ChunkEnd(this->chunkStart, this->spanEnd, this->chunkSize);
+                return *this;
+            }
+
+            Iterator operator++(int)
+            {
+                Iterator old = *this;
+                ++(*this);
+                return old;
+            }
+
+            bool operator==(const Iterator &other) const
+            {
+                return this->chunkStart == other.chunkStart;
+            }
+
+            bool operator!=(const Iterator &other) const
+            {
+                return this->chunkStart != other.chunkStart;
+            }
+        };
+
+    private:
+        span_iterator spanStart;
+        span_iterator spanEnd;
+        size_t chunkSize;
+
+    public:
+        /**
+         * @brief Construct a new range of chunks.
+         *
+         * @param start The start of the span to chunk.
+         * @param end The end of the span to chunk.
+         * @param chunkSize The number of elements in a chunk, must be larger than 0.
+         */
+        constexpr SpanChunks(span_iterator start, span_iterator end, size_t chunkSize) : spanStart(start), spanEnd(end), chunkSize(chunkSize) {}
+
+        /**
+         * @brief Retrieve a iterator to the first chunk.
+         *
+         * @return Iterator The iterator to the first chunk.
+         */
+        Iterator begin() const
+        {
+            return Iterator(this->spanStart, this->spanEnd, this->chunkSize);
+        }
+
+        /**
+         * @brief Retrieve a iterator that is 1 passed the last chunk.
+         *
+         * @return Iterator The iterator passed the last chunk.
+         */
+        Iterator end() const
+        {
+            return Iterator(this->spanEnd, this->spanEnd, this->chunkSize);
+        }
+
+        /**
+         * @brief Returns the number of chunks (the last one included when it is shorter).
+         *
+         * @return size_t The number of chunks.
+         */
+        size_t Count() const
+        {
+            return (libEmbedded::Distance(this->spanStart, this->spanEnd) + this->chunkSize - 1) / this->chunkSize;
+        }
+
+    private:
+        static span_iterator ChunkEnd(span_iterator start, span_iterator end, size_t chunkSize)
+        {
+            return ChunkEnd(start, end, chunkSize, typename iterator_traits<span_iterator>::iterator_category());
+        }
+
+        static span_iterator ChunkEnd(span_iterator start, span_iterator end, size_t chunkSize, forward_iterator_tag)
+        {
+            // Step instead of using Distance so a chunk costs chunkSize steps and not the length of the rest of the span.
+            while (chunkSize > 0 && start != end)
+            {
+                ++start;
+                --chunkSize;
+            }
+            return start;
+        }
+
+        static span_iterator ChunkEnd(span_iterator start, span_iterator end, size_t chunkSize, random_access_iterator_tag)
+        {
+            return libEmbedded::Distance(start, end) < chunkSize ? end : start + chunkSize;
+        }
+    };
+
     /*
      * @brief A span that represents a sequence of elements that can only be read.
      * 
@@ -84,7 +225,7 @@ namespace libEmbedded
          * 
          * @return const_iterator The iterator at the start that can only read the span.
          */
-        const_iterator begin() const
+        constexpr const_iterator begin() const
         {
             return spanStart;
         }
@@ -94,7 +235,7 @@ namespace libEmbedded
          * 
          * @return const_iterator The iterator at the start that can only read the span.
          */
-        const_iterator cbegin() const
+        constexpr const_iterator cbegin() const
         {
             return spanStart;
         }
@@ -114,7 +255,7 @@ namespace libEmbedded
          * 
          * @return iterator A iterator that can only read the span that is one passed the last element in the span.
          */
-        const_iterator end() const
+        constexpr const_iterator end() const
         {
             return spanEnd;
         }
@@ -124,45 +265,100 @@ namespace libEmbedded
          * 
          * @return iterator A iterator that can only read the span that is one passed the last element in the span.
          */
-        const_iterator cend() const
+        constexpr const_iterator cend() const
         {
             return spanEnd;
         }
 
         /**
-         * @brief Retrieve the item at the given index. Does not do any bounds checks!
+         * @brief Retrieve the item at the given index, O(1) for random access iterators. Does not do any bounds checks!
          * 
          * @param index The index to retrieve the item from.
          * @return const T& A readonly reference to the item at the given index.
          */
-        const T& operator[](size_t index) const
+        constexpr const T& operator[](size_t index) const
         {
-            auto it = cbegin();
-            size_t i = index;
-            while(i > 0)
-            {
-                --i;
-                ++it;
-            }
-            return *it;
+            return *libEmbedded::Next(cbegin(), index);
         }
 
         /**
-         * @brief Retrieve the item at the given index. Does not do any bounds checks!
+         * @brief Retrieve the item at the given index, O(1) for random access iterators. Does not do any bounds checks!
          * 
          * @param index The index to retrieve the item from.
          * @return const T& A readonly reference to the item at the given index.
          */
         T& operator[](size_t index)
         {
-            auto it = begin();
-            size_t i = index;
-            while(i > 0)
-            {
-                --i;
-                ++it;
-            }
-            return *it;
+            return *libEmbedded::Next(begin(), index);
+        }
+
+        /**
+         * @brief Retrieve count elements starting at offset as a new span, O(1) for random access iterators.
+         * Nothing is copied. Does not do any bounds checks!
+         * 
+         * @param offset The index of the first element of the subspan.
+         * @param count The number of elements in the subspan.
+         * @return Span The subspan.
+         */
+        constexpr Span Subspan(size_t offset, size_t count) const
+        {
+            return Span(libEmbedded::Next(spanStart, offset), libEmbedded::Next(spanStart, offset + count));
+        }
+
+        /**
+         * @brief Retrieve the elements from offset up to the end as a new span, O(1) for random access iterators.
+         * Nothing is copied. Does not do any bounds checks!
+         * 
+         * @param offset The index of the first element of the subspan.
+         * @return Span The subspan.
+         */
+        constexpr Span Subspan(size_t offset) const
+        {
+            return Span(libEmbedded::Next(spanStart, offset), spanEnd);
+        }
+
+        /**
+         * @brief Retrieve the first count elements as a new span. Does not do any bounds checks!
+         * 
+         * @param count The number of elements.
+         * @return Span The first count elements.
+         */
+        constexpr Span First(size_t count) const
+        {
+            return Span(spanStart, libEmbedded::Next(spanStart, count));
+        }
+
+        /**
+         * @brief Retrieve the last count elements as a new span. Does not do any bounds checks!
+         * 
+         * @param count The number of elements.
+         * @return Span The last count elements.
+         */
+        constexpr Span Last(size_t count) const
+        {
+            return Span(libEmbedded::Prev(spanEnd, count), spanEnd);
+        }
+
+        /**
+         * @brief Split the span in the first index elements and the rest. Does not do any bounds checks!
+         * 
+         * @param index The number of elements in the first half.
+         * @return SpanSplit<Span> The first index elements and the elements after them.
+         */
+        constexpr SpanSplit<Span> SplitAt(size_t index) const
+        {
+            return SpanSplit<Span>{First(index), Subspan(index)};
+        }
+
+        /**
+         * @brief Iterate over the span in consecutive sub-spans of chunkSize elements, the last chunk holds the rest.
+         * 
+         * @param chunkSize The number of elements in a chunk, must be larger than 0.
+         * @return SpanChunks<Span> The range of chunks.
+         */
+        constexpr SpanChunks<Span> Chunks(size_t chunkSize) const
+        {
+            return SpanChunks<Span>(spanStart, spanEnd, chunkSize);
         }
 
         /**
@@ -278,7 +474,7 @@ namespace libEmbedded
          * 
          * @return const_iterator The iterator at the start that can only read the span.
          */
-        const_iterator begin() const
+        constexpr const_iterator begin() const
         {
             return spanStart;
         }
@@ -288,7 +484,7 @@ namespace libEmbedded
          * 
          * @return const_iterator The iterator at the start that can only read the span.
          */
-        const_iterator cbegin() const
+        constexpr const_iterator cbegin() const
         {
             return spanStart;
         }
@@ -298,7 +494,7 @@ namespace libEmbedded
          * 
          * @return iterator A iterator that can only read the span that is one passed the last element in the span.
          */
-        const_iterator end() const
+        constexpr const_iterator end() const
         {
             return spanEnd;
         }
@@ -308,27 +504,89 @@ namespace libEmbedded
          * 
          * @return iterator A iterator that can only read the span that is one passed the last element in the span.
          */
-        const_iterator cend() const
+        constexpr const_iterator cend() const
         {
             return spanEnd;
         }
 
         /**
-         * @brief Retrieve the item at the given index. Does not do any bounds checks!
+         * @brief Retrieve the item at the given index, O(1) for random access iterators. Does not do any bounds checks!
          * 
          * @param index The index to retrieve the item from.
          * @return const T& A readonly reference to the item at the given index.
          */
-        const T& operator[](size_t index) const
+        constexpr const T& operator[](size_t index) const
         {
-            auto it = begin();
-            size_t i = index;
-            while(i > 0)
-            {
-                --i;
-                ++it;
-            }
-            return *it;
+            return *libEmbedded::Next(begin(), index);
+        }
+
+        /**
+         * @brief Retrieve count elements starting at offset as a new span, O(1) for random access iterators.
+         * Nothing is copied. Does not do any bounds checks!
+         * 
+         * @param offset The index of the first element of the subspan.
+         * @param count The number of elements in the subspan.
+         * @return Span The subspan.
+         */
+        constexpr Span Subspan(size_t offset, size_t count) const
+        {
+            return Span(libEmbedded::Next(spanStart, offset), libEmbedded::Next(spanStart, offset + count));
+        }
+
+        /**
+         * @brief Retrieve the elements from offset up to the end as a new span, O(1) for random access iterators.
+         * Nothing is copied. Does not do any bounds checks!
+         * 
+         * @param offset The index of the first element of the subspan.
+         * @return Span The subspan.
+         */
+        constexpr Span Subspan(size_t offset) const
+        {
+            return Span(libEmbedded::Next(spanStart, offset), spanEnd);
+        }
+
+        /**
+         * @brief Retrieve the first count elements as a new span. Does not do any bounds checks!
+         * 
+         * @param count The number of elements.
+         * @return Span The first count elements.
+         */
+        constexpr Span First(size_t count) const
+        {
+            return Span(spanStart, libEmbedded::Next(spanStart, count));
+        }
+
+        /**
+         * @brief Retrieve the last count elements as a new span. Does not do any bounds checks!
+         * 
+         * @param count The number of elements.
+         * @return Span The last count elements.
+         */
+        constexpr Span Last(size_t count) const
+        {
+            return Span(libEmbedded::Prev(spanEnd, count), spanEnd);
+        }
+
+        /**
+         * @brief Split the span in the first index elements and the rest. Does not do any bounds checks!
+         * 
+         * @param index The number of elements in the first half.
+         * @return SpanSplit<Span> The first index elements and the elements after them.
+         */
+        constexpr SpanSplit<Span> SplitAt(size_t index) const
+        {
+            return SpanSplit<Span>{First(index), Subspan(index)};
+        }
+
+        /**
+         * @brief Iterate over the span in consecutive sub-spans of chunkSize elements, the last chunk holds the rest.
+         * 
+         * @param chunkSize The number of elements in a chunk, must be larger than 0.
+         * @return SpanChunks<Span> The range of chunks.
+         */
+        constexpr SpanChunks<Span> Chunks(size_t chunkSize) const
+        {
+            return SpanChunks<Span>(spanStart, spanEnd, chunkSize);
         }
         
         /**
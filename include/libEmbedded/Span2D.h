@@ -0,0 +1,324 @@
+/**
+ * @file Span2D.h
+ * @author Giel Willemsen
+ * @brief A 2D view on a flat array, for images and matrices (like a two dimensional mdspan).
+ * @version 0.1 2026-10-17 Initial version
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * @details
+ * The elements are stored row after row, rows are pitch elements apart (the pitch can be larger than the number
+ * of columns for padded rows or for a view on a part of a larger image). A row is a contiguous Span, a column is a
+ * StridedSpan and a Subview is again a Span2D with the same pitch, so none of them copy anything.
+ * Tiles splits the view in blocks that are visited one after the other, for a cache blocked traversal.
+ */
+#pragma once
+#ifndef LIBEMBEDDED_SPAN_2D_H
+#define LIBEMBEDDED_SPAN_2D_H
+#include <stddef.h>
+#include "libEmbedded/TypeTrait.h"
+#include "libEmbedded/Span.h"
+#include "libEmbedded/StridedSpan.h"
+
+namespace libEmbedded
+{
+    template <typename T>
+    class Span2DTiles;
+
+    /**
+     * @brief A view of rows x columns elements stored row by row in a flat array.
+     *
+     * @tparam T The type of the element, const T for a readonly view.
+     */
+    template <typename T>
+    class Span2D
+    {
+    private:
+        T *data;
+        size_t rows;
+        size_t columns;
+        size_t pitch;
+
+    public:
+        /**
+         * @brief Construct a new view on rows without padding.
+         *
+         * @param data The first element of the first row.
+         * @param rows The number of rows.
+         * @param columns The number of columns (and elements between the start of two rows).
+         */
+        constexpr Span2D(T *data, size_t rows, size_t columns) : data(data), rows(rows), columns(columns), pitch(columns) {}
+
+        /**
+         * @brief Construct a new view on rows that are pitch elements apart.
+         *
+         * @param data The first element of the first row.
+         * @param rows The number of rows.
+         * @param columns The number of columns.
+         * @param pitch The number of elements between the start of two rows, at least columns.
+         */
+        constexpr Span2D(T *data, size_t rows, size_t columns, size_t pitch) : data(data), rows(rows), columns(columns), pitch(pitch) {}
+
+        /**
+         * @brief Construct a readonly view from a modifiable one.
+         *
+         * @param view The view to create this one from.
+         */
+        template <typename U, typename = typename enable_if<is_same<const U, T>::value && !is_same<U, T>::value>::type>
+        constexpr Span2D(const Span2D<U> &view) : data(view.Data()), rows(view.Rows()), columns(view.Columns()), pitch(view.Pitch()) {}
+
+        /**
+         * @brief Returns the number of rows.
+         *
+         * @return size_t The number of rows.
+         */
+        constexpr size_t Rows() const
+        {
+            return this->rows;
+        }
+
+        /**
+         * @brief Returns the number of columns.
+         *
+         * @return size_t The number of columns.
+         */
+        constexpr size_t Columns() const
+        {
+            return this->columns;
+        }
+
+        /**
+         * @brief Returns the number of elements between the start of two rows.
+         *
+         * @return size_t The pitch in elements.
+         */
+        constexpr size_t Pitch() const
+        {
+            return this->pitch;
+        }
+
+        /**
+         * @brief Returns the first element of the first row.
+         *
+         * @return T* The first element.
+         */
+        constexpr T *Data() const
+        {
+            return this->data;
+        }
+
+        /**
+         * @brief Retrieve a element. Does not do any bounds checks!
+         *
+         * @param row The row of the element.
+         * @param column The column of the element.
+         * @return T& A reference to the element.
+         */
+        constexpr T &operator()(size_t row, size_t column) const
+        {
+            return this->data[row * this->pitch + column];
+        }
+
+        /**
+         * @brief Retrieve a row. Does not do any bounds checks!
+         *
+         * @param row The index of the row.
+         * @return Span<T> The elements of the row.
+         */
+        constexpr Span<T> Row(size_t row) const
+        {
+            return Span<T>(this->data + row * this->pitch, this->columns);
+        }
+
+        /**
+         * @brief Retrieve a column. Does not do any bounds checks!
+         *
+         * @param column The index of the column.
+         * @return StridedSpan<T> The elements of the column, top to bottom.
+         */
+        constexpr StridedSpan<T> Column(size_t column) const
+        {
+            return StridedSpan<T>(this->data + column, this->rows, static_cast<ptrdiff_t>(this->pitch));
+        }
+
+        /**
+         * @brief Retrieve a rectangular part of the view. Does not do any bounds checks!
+         *
+         * @param row The first row of the part.
+         * @param column The first column of the part.
+         * @param rows The number of rows of the part.
+         * @param columns The number of columns of the part.
+         * @return Span2D<T> The part, with the same pitch as this view.
+         */
+        constexpr Span2D<T> Subview(size_t row, size_t column, size_t rows, size_t columns) const
+        {
+            return Span2D<T>(this->data + row * this->pitch + column, rows, columns, this->pitch);
+        }
+
+        /**
+         * @brief Check if the rows are stored without padding, so all elements are one contiguous array.
+         *
+         * @return true If the pitch is the number of columns (or there is at most one row).
+         * @return false If there is padding between the rows.
+         */
+        constexpr bool IsContiguous() const
+        {
+            return this->pitch == this->columns || this->rows <= 1;
+        }
+
+        /**
+         * @brief Iterate over the view in tiles of tileRows x tileColumns, row of tiles by row of tiles. The tiles at
+         * the right and bottom edge are smaller when the size is not a multiple of the tile size.
+         *
+         * @param tileRows The number of rows of a tile, must be larger than 0.
+         * @param tileColumns The number of columns of a tile, must be larger than 0.
+         * @return Span2DTiles<T> The range of tiles.
+         */
+        constexpr Span2DTiles<T> Tiles(size_t tileRows, size_t tileColumns) const
+        {
+            return Span2DTiles<T>(*this, tileRows, tileColumns);
+        }
+    };
+
+    /**
+     * @brief Range over the tiles of a Span2D, created by Span2D::Tiles.
+     *
+     * @tparam T The type of the element.
+     */
+    template <typename T>
+    class Span2DTiles
+    {
+    public:
+        /**
+         * @brief Iterator that yields the tiles as Span2D.
+         *
+         */
+        class Iterator
+        {
+        private:
+            const Span2DTiles *tiles;
+            size_t tileRow;
+            size_t tileColumn;
+
+        public:
+            Iterator(const Span2DTiles *tiles, size_t tileRow, size_t tileColumn) : tiles(tiles), tileRow(tileRow), tileColumn(tileColumn) {}
+
+            Span2D<T> operator*() const
+            {
+                return this->tiles->Tile(this->tileRow, this->tileColumn);
+            }
+
+            Iterator &operator++()
+            {
+                this->tileColumn++;
+                if (this->tileColumn == this->tiles->TileColumns())
+                {
+                    this->tileColumn = 0;
+                    this->tileRow++;
+                }
+                return *this;
+            }
+
+            Iterator operator++(int)
+            {
+                Iterator old = *this;
+                ++(*this);
+                return old;
+            }
+
+            bool operator==(const Iterator &other) const
+            {
+                return this->tileRow == other.tileRow && this->tileColumn == other.tileColumn;
+            }
+
+            bool operator!=(const Iterator &other) const
+            {
+                return !(*this == other);
+            }
+        };
+
+    private:
+        Span2D<T> view;
+        size_t tileRows;
+        size_t tileColumns;
+
+    public:
+        /**
+         * @brief Construct a new range of tiles.
+         *
+         * @param view The view to split in tiles.
+         * @param tileRows The number of rows of a tile, must be larger than 0.
+         * @param tileColumns The number of columns of a tile, must be larger than 0.
+         */
+        constexpr Span2DTiles(const Span2D<T> &view, size_t tileRows, size_t tileColumns) : view(view), tileRows(tileRows), tileColumns(tileColumns) {}
+
+        /**
+         * @brief Retrieve a iterator to the top left tile.
+         *
+         * @return Iterator The iterator to the first tile.
+         */
+        Iterator begin() const
+        {
+            return this->TileColumns() == 0 ? this->end() : Iterator(this, 0, 0);
+        }
+
+        /**
+         * @brief Retrieve a iterator that is 1 passed the bottom right tile.
+         *
+         * @return Iterator The iterator passed the last tile.
+         */
+        Iterator end() const
+        {
+            return Iterator(this, this->TileRows(), 0);
+        }
+
+        /**
+         * @brief Returns the number of rows of tiles.
+         *
+         * @return size_t The number of tiles from top to bottom.
+         */
+        constexpr size_t TileRows() const
+        {
+            return (this->view.Rows() + this->tileRows - 1) / this->tileRows;
+        }
+
+        /**
+         * @brief Returns the number of columns of tiles.
+         *
+         * @return size_t The number of tiles from left to right.
+         */
+        constexpr size_t TileColumns() const
+        {
+            return (this->view.Columns() + this->tileColumns - 1) / this->tileColumns;
+        }
+
+        /**
+         * @brief Returns the number of tiles.
+         *
+         * @return size_t The number of tiles.
+         */
+        constexpr size_t Count() const
+        {
+            return this->TileRows() * this->TileColumns();
+        }
+
+        /**
+         * @brief Retrieve a tile. Does not do any bounds checks!
+         *
+         * @param tileRow The row of the tile, in tiles.
+         * @param tileColumn The column of the tile, in tiles.
+         * @return Span2D<T> The tile.
+         */
+        Span2D<T> Tile(size_t tileRow, size_t tileColumn) const
+        {
+            const size_t row = tileRow * this->tileRows;
+            const size_t column = tileColumn * this->tileColumns;
+            const size_t rows = this->view.Rows() - row < this->tileRows ? this->view.Rows() - row : this->tileRows;
+            const size_t columns = this->view.Columns() - column < this->tileColumns ? this->view.Columns() - column : this->tileColumns;
+            return this->view.Subview(row, column, rows, columns);
+        }
+    };
+} // namespace libEmbedded
+
+#endif // LIBEMBEDDED_SPAN_2D_H
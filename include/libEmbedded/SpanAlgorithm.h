@@ -0,0 +1,303 @@
+/**
+ * @file SpanAlgorithm.h
+ * @author Giel Willemsen
+ * @brief Algorithms on the contents of spans (compare, fill, copy and search).
+ * @version 0.1 2026-10-17 Initial version
+ * @version 0.2 2026-10-17 Fill and CopyTo take the destination by reference so they also write into containers.
+ * @version 0.3 2026-10-17 No memset or memchr on bool, not every byte value is a valid bool.
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * @details
+ * The Span operator== compares the iterators, these compare the elements. They work on anything with
+ * begin()/end() (Span, StaticSpan, the STL containers), and on spans of pointers to integral or trivially copyable
+ * elements they go through memcmp, memset, memmove and memchr. The C library implements those with the widest
+ * vector instructions of the target, so the fast path needs no intrinsics and stays portable. Everything else uses
+ * a plain loop.
+ */
+#pragma once
+#ifndef LIBEMBEDDED_SPAN_ALGORITHM_H
+#define LIBEMBEDDED_SPAN_ALGORITHM_H
+#include <stddef.h>
+#include <string.h>
+#include "libEmbedded/TypeTrait.h"
+#include "libEmbedded/Iterator.h"
+
+namespace libEmbedded
+{
+    /**
+     * @brief The element type of a pointer iterator, without const or volatile.
+     *
+     */
+    template <typename TIter>
+    struct PointerElement
+    {
+        typedef typename remove_cv<typename remove_pointer<TIter>::type>::type type;
+    };
+
+    /**
+     * @brief True when both iterators are pointers to the same integral type, those are equal when their bytes are.
+     *
+     */
+    template <typename TIterA, typename TIterB>
+    struct IsIntegralPointerPair : integral_constant<bool, is_pointer<TIterA>::value && is_pointer<TIterB>::value && is_same<typename PointerElement<TIterA>::type, typename PointerElement<TIterB>::type>::value && is_integral<typename PointerElement<TIterA>::type>::value>
+    {
+    };
+
+    /**
+     * @brief True when the iterator is a pointer to unsigned char (uint8_t), those compare like memcmp does.
+     *
+     */
+    template <typename TIter>
+    struct IsUnsignedBytePointer : integral_constant<bool, is_pointer<TIter>::value && is_same<typename PointerElement<TIter>::type, unsigned char>::value>
+    {
+    };
+
+    /**
+     * @brief True when the iterator is a pointer to a byte sized integral (the types memset and memchr work on).
+     * bool is excluded, memset would store the byte of the value (like 2) which is not a valid bool.
+     *
+     */
+    template <typename TIter>
+    struct IsBytePointer : integral_constant<bool, is_pointer<TIter>::value && is_integral<typename PointerElement<TIter>::type>::value && sizeof(typename PointerElement<TIter>::type) == 1 && !is_same<typename PointerElement<TIter>::type, bool>::value>
+    {
+    };
+
+    template <typename TIterA, typename TIterB>
+    bool Equal(TIterA a, TIterA aEnd, TIterB b, TIterB bEnd, false_type)
+    {
+        while (a != aEnd && b != bEnd)
+        {
+            if (!(*a == *b))
+            {
+                return false;
+            }
+            ++a;
+            ++b;
+        }
+        return a == aEnd && b == bEnd;
+    }
+
+    template <typename TIterA, typename TIterB>
+    bool Equal(TIterA a, TIterA aEnd, TIterB b, TIterB bEnd, true_type)
+    {
+        const size_t size = static_cast<size_t>(aEnd - a);
+        return size == static_cast<size_t>(bEnd - b) && (size == 0 || memcmp(a, b, size * sizeof(*a)) == 0);
+    }
+
+    /**
+     * @brief Check if two spans hold the same number of elements and all elements are equal.
+     *
+     * @tparam TSpanA The type of the first span.
+     * @tparam TSpanB The type of the second span.
+     * @param a The first span.
+     * @param b The second span.
+     * @return true If the contents are equal.
+     * @return false If the sizes or any of the elements differ.
+     */
+    template <typename TSpanA, typename TSpanB>
+    bool Equal(const TSpanA &a, const TSpanB &b)
+    {
+        return Equal(a.begin(), a.end(), b.begin(), b.end(), IsIntegralPointerPair<decltype(a.begin()), decltype(b.begin())>());
+    }
+
+    template <typename TIterA, typename TIterB>
+    int Compare(TIterA a, TIterA aEnd, TIterB b, TIterB bEnd, false_type)
+    {
+        while (a != aEnd && b != bEnd)
+        {
+            if (*a < *b)
+            {
+                return -1;
+            }
+            if (*b < *a)
+            {
+                return 1;
+            }
+            ++a;
+            ++b;
+        }
+        return a != aEnd ? 1 : (b != bEnd ? -1 : 0);
+    }
+
+    template <typename TIterA, typename TIterB>
+    int Compare(TIterA a, TIterA aEnd, TIterB b, TIterB bEnd, true_type)
+    {
+        const size_t aSize = static_cast<size_t>(aEnd - a);
+        const size_t bSize = static_cast<size_t>(bEnd - b);
+        const int result = memcmp(a, b, aSize < bSize ? aSize : bSize);
+        if (result != 0)
+        {
+            return result < 0 ? -1 : 1;
+        }
+        return aSize > bSize ? 1 : (aSize < bSize ? -1 : 0);
+    }
+
+    /**
+     * @brief Compare the contents of two spans lexicographically (a span that is the start of the other is smaller).
+     *
+     * @tparam TSpanA The type of the first span.
+     * @tparam TSpanB The type of the second span.
+     * @param a The first span.
+     * @param b The second span.
+     * @return int -1 if a is smaller, 0 if the contents are equal and 1 if a is larger.
+     */
+    template <typename TSpanA, typename TSpanB>
+    int Compare(const TSpanA &a, const TSpanB &b)
+    {
+        return Compare(a.begin(), a.end(), b.begin(), b.end(), integral_constant<bool, IsIntegralPointerPair<decltype(a.begin()), decltype(b.begin())>::value && IsUnsignedBytePointer<decltype(a.begin())>::value>());
+    }
+
+    template <typename TIter, typename TValue>
+    void Fill(TIter begin, TIter end, const TValue &value, false_type)
+    {
+        for (; begin != end; ++begin)
+        {
+            *begin = value;
+        }
+    }
+
+    template <typename TIter, typename TValue>
+    void Fill(TIter begin, TIter end, const TValue &value, true_type)
+    {
+        memset(begin, static_cast<unsigned char>(value), static_cast<size_t>(end - begin));
+    }
+
+    /**
+     * @brief Assign value to every element of the span.
+     *
+     * @tparam TSpan The type of the span.
+     * @tparam TValue The type of the value.
+     * @param span The span or container to fill.
+     * @param value The value to assign.
+     */
+    template <typename TSpan, typename TValue>
+    void Fill(TSpan &&span, const TValue &value)
+    {
+        Fill(span.begin(), span.end(), value, integral_constant<bool, IsBytePointer<decltype(span.begin())>::value && is_integral<TValue>::value>());
+    }
+
+    template <typename TIterSource, typename TIterDestination>
+    size_t CopyTo(TIterSource source, TIterSource sourceEnd, TIterDestination destination, TIterDestination destinationEnd, false_type)
+    {
+        size_t count = 0;
+        while (source != sourceEnd && destination != destinationEnd)
+        {
+            *destination = *source;
+            ++source;
+            ++destination;
+            count++;
+        }
+        return count;
+    }
+
+    template <typename TIterSource, typename TIterDestination>
+    size_t CopyTo(TIterSource source, TIterSource sourceEnd, TIterDestination destination, TIterDestination destinationEnd, true_type)
+    {
+        const size_t sourceSize = static_cast<size_t>(sourceEnd - source);
+        const size_t destinationSize = static_cast<size_t>(destinationEnd - destination);
+        const size_t count = sourceSize < destinationSize ? sourceSize : destinationSize;
+        if (count > 0)
+        {
+            memmove(destination, source, count * sizeof(*source));
+        }
+        return count;
+    }
+
+    /**
+     * @brief Copy the elements of source to the start of destination, as many as fit. The spans may overlap when they
+     * are spans of pointers to a trivially copyable type.
+     *
+     * @tparam TSourceSpan The type of the source span.
+     * @tparam TDestinationSpan The type of the destination span.
+     * @param source The elements to copy.
+     * @param destination The span or container to copy to.
+     * @return size_t The number of elements copied, the smallest of the two sizes.
+     */
+    template <typename TSourceSpan, typename TDestinationSpan>
+    size_t CopyTo(const TSourceSpan &source, TDestinationSpan &&destination)
+    {
+        typedef decltype(source.begin()) TIterSource;
+        typedef decltype(destination.begin()) TIterDestination;
+        return CopyTo(source.begin(), source.end(), destination.begin(), destination.end(),
+                      integral_constant<bool, is_pointer<TIterSource>::value && is_pointer<TIterDestination>::value && is_same<typename PointerElement<TIterSource>::type, typename PointerElement<TIterDestination>::type>::value && is_trivially_copyable<typename PointerElement<TIterSource>::type>::value>());
+    }
+
+    template <typename TIter, typename TValue>
+    TIter Find(TIter begin, TIter end, const TValue &value, false_type)
+    {
+        while (begin != end && !(*begin == value))
+        {
+            ++begin;
+        }
+        return begin;
+    }
+
+    template <typename TIter, typename TValue>
+    TIter Find(TIter begin, TIter end, const TValue &value, true_type)
+    {
+        typedef typename PointerElement<TIter>::type TElement;
+        // memchr only looks at the low byte, a value that does not fit in the element can never be found.
+        if (begin == end || static_cast<TValue>(static_cast<TElement>(value)) != value)
+        {
+            return end;
+        }
+        const void *found = memchr(begin, static_cast<unsigned char>(value), static_cast<size_t>(end - begin));
+        return found == nullptr ? end : begin + (static_cast<const unsigned char *>(found) - reinterpret_cast<const unsigned char *>(begin));
+    }
+
+    /**
+     * @brief Find the first element that is equal to value.
+     *
+     * @tparam TSpan The type of the span.
+     * @tparam TValue The type of the value.
+     * @param span The span to search in.
+     * @param value The value to look for.
+     * @return The iterator to the first matching element, or the end of the span when there is none.
+     */
+    template <typename TSpan, typename TValue>
+    auto Find(const TSpan &span, const TValue &value) -> decltype(span.begin())
+    {
+        return Find(span.begin(), span.end(), value, integral_constant<bool, IsBytePointer<decltype(span.begin())>::value && is_integral<TValue>::value>());
+    }
+
+    /**
+     * @brief Count the elements that are equal to value.
+     *
+     * @tparam TSpan The type of the span.
+     * @tparam TValue The type of the value.
+     * @param span The span to search in.
+     * @param value The value to count.
+     * @return size_t The number of matching elements.
+     */
+    template <typename TSpan, typename TValue>
+    size_t Count(const TSpan &span, const TValue &value)
+    {
+        // A plain loop without a early exit, whether it is vectorized depends on the compiler and optimization level.
+        size_t count = 0;
+        for (auto it = span.begin(); it != span.end(); ++it)
+        {
+            count += (*it == value) ? 1 : 0;
+        }
+        return count;
+    }
+
+    /**
+     * @brief Check if any element is equal to value.
+     *
+     * @tparam TSpan The type of the span.
+     * @tparam TValue The type of the value.
+     * @param span The span to search in.
+     * @param value The value to look for.
+     * @return true If the value is in the span.
+     * @return false If it is not.
+     */
+    template <typename TSpan, typename TValue>
+    bool Contains(const TSpan &span, const TValue &value)
+    {
+        return libEmbedded::Find(span, value) != span.end();
+    }
+} // namespace libEmbedded
+
+#endif // LIBEMBEDDED_SPAN_ALGORITHM_H
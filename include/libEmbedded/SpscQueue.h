@@ -0,0 +1,320 @@
+/**
+ * @file SpscQueue.h
+ * @author Giel Willemsen
+ * @brief A lock-free queue of a static size for exactly one producer and one consumer thread.
+ * @version 0.1 2026-10-17 Initial version
+ * @version 0.2 2026-10-17 OverflowPolicy::BLOCK with a Push that waits (with a timeout) for a consumer to make room.
+ * @version 0.3 2026-10-17 TryPush(T&&) and the elements are moved out of the queue, so move-only types can be queued.
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * @details
+ * The producer only writes the tail index and the consumer only writes the head index, so the two sides
+ * never have to lock. Each side also keeps a cached copy of the index of the other side so it only has to
+ * touch the cache line of the other side when its cached copy says the queue is full (or empty).
+ * Just like Buffer.h no heap memory is used, all the storage is part of the object itself.
+ * Both TryPush and TryPop are async-signal-safe when std::atomic<size_t> is lock free (and the policy isn't BLOCK).
+ */
+#pragma once
+#ifndef LIBEMBEDDED_SPSC_QUEUE_H
+#define LIBEMBEDDED_SPSC_QUEUE_H
+#include <stddef.h>
+#include <atomic>
+#include <chrono>
+#include <new>
+#include "libEmbedded/TypeTrait.h"
+#include "libEmbedded/Helpers.h"
+#include "libEmbedded/OverflowPolicy.h"
+#include "libEmbedded/OverflowWaiter.h"
+
+namespace libEmbedded
+{
+    /**
+     * @brief Lock-free fixed size queue for a single producer and a single consumer.
+     * Unlike Buffer the oldest elements are never dropped, a push on a full queue fails instead.
+     *
+     * @tparam T The type of the element in the queue.
+     * @tparam TNumElements The maximum number of elements the queue can hold.
+     * @tparam TOverflowPolicy REJECT (a push on a full queue fails) or BLOCK (Push can also wait for room).
+     */
+    template <typename T, size_t TNumElements, OverflowPolicy TOverflowPolicy = OverflowPolicy::REJECT>
+    class SpscQueue
+    {
+        static_assert(TOverflowPolicy != OverflowPolicy::DROP_OLDEST, "The consumer owns the front of a SpscQueue, so the producer can't drop the oldest element.");
+
+    private:
+        // One slot more than the capacity so a full queue can be told apart from a empty one.
+        static constexpr size_t kSlots = TNumElements + 1;
+
+        // Consumer owned.
+        alignas(kCacheLineSize) std::atomic<size_t> head;
+        size_t cachedTail;
+
+        // Producer owned.
+        alignas(kCacheLineSize) std::atomic<size_t> tail;
+        size_t cachedHead;
+
+        alignas(kCacheLineSize) typename aligned_storage<kSlots * sizeof(T), alignof(T)>::type workspace;
+
+        OverflowWaiter<TOverflowPolicy> waiter;
+
+    public:
+        /**
+         * @brief Construct a new empty queue.
+         *
+         */
+        SpscQueue() : head(0), cachedTail(0), tail(0), cachedHead(0) {}
+
+        /**
+         * @brief The queue is shared between threads, so copying it makes no sense.
+         *
+         */
+        SpscQueue(const SpscQueue<T, TNumElements, TOverflowPolicy> &) = delete;
+
+        /**
+         * @brief The queue is shared between threads, so copying it makes no sense.
+         *
+         */
+        SpscQueue<T, TNumElements, TOverflowPolicy> &operator=(const SpscQueue<T, TNumElements, TOverflowPolicy> &) = delete;
+
+        /**
+         * @brief Destroy the queue and the elements that were never popped.
+         *
+         */
+        ~SpscQueue();
+
+        /**
+         * @brief Add the element to the back of the queue. May only be called from the producer thread.
+         *
+         * @param element The element to add to the queue.
+         * @return true If the element was added.
+         * @return false If the queue was full and nothing was added.
+         */
+        bool TryPush(const T &element);
+
+        /**
+         * @brief Move the element to the back of the queue. May only be called from the producer thread.
+         *
+         * @param element The element to move into the queue, untouched when the queue was full.
+         * @return true If the element was added.
+         * @return false If the queue was full and nothing was added.
+         */
+        bool TryPush(T &&element);
+
+        /**
+         * @brief Add the element to the back of the queue, waiting for a consumer to make room if it is full. May only be called from the producer thread.
+         * Only available with OverflowPolicy::BLOCK, the consumers only pay for it when a producer is actually waiting.
+         *
+         * @tparam TRep The representation type of the timeout.
+         * @tparam TPeriod The period of the timeout.
+         * @param element The element to add to the queue.
+         * @param timeout The maximum time to wait for room.
+         * @return true If the element was added.
+         * @return false If the queue stayed full for the whole timeout, nothing was added.
+         */
+        template <typename TRep, typename TPeriod>
+        bool Push(const T &element, const std::chrono::duration<TRep, TPeriod> &timeout);
+
+        /**
+         * @brief Add as many of the given elements to the back of the queue as fit. May only be called from the producer thread.
+         *
+         * @param elements The elements to add to the queue.
+         * @param elementCount The number of elements to add.
+         * @return size_t The number of elements (from the start of elements) actually added.
+         */
+        size_t TryPushRange(const T *elements, size_t elementCount);
+
+        /**
+         * @brief Take the element at the front of the queue. May only be called from the consumer thread.
+         *
+         * @param element Set to the element that was taken from the queue.
+         * @return true If a element was taken.
+         * @return false If the queue was empty, element is untouched.
+         */
+        bool TryPop(T &element);
+
+        /**
+         * @brief Take up to maxCount elements from the front of the queue. May only be called from the consumer thread.
+         *
+         * @param elements The memory to move the taken elements to.
+         * @param maxCount The maximum number of elements to take.
+         * @return size_t The number of elements taken.
+         */
+        size_t TryPopRange(T *elements, size_t maxCount);
+
+        /**
+         * @brief Returns the number of elements in the queue.
+         * When called while the other side is busy this is only a snapshot.
+         *
+         * @return size_t The number of elements in the queue.
+         */
+        size_t Size() const;
+
+        /**
+         * @brief Returns the maximum number of elements that could possibly be in the queue.
+         *
+         * @return size_t The maximum number of elements possible in the queue.
+         */
+        size_t Capacity() const;
+
+    private:
+        static constexpr size_t Wrap(size_t index)
+        {
+            return index >= kSlots ? index - kSlots : index;
+        }
+
+        static constexpr size_t Used(size_t head, size_t tail)
+        {
+            return tail >= head ? tail - head : tail + kSlots - head;
+        }
+
+        template <typename TElement>
+        bool TryPushElement(TElement &&element);
+
+        T *GetSlot(size_t index);
+    };
+
+    template <typename T, size_t TNumElements, OverflowPolicy TOverflowPolicy>
+    SpscQueue<T, TNumElements, TOverflowPolicy>::~SpscQueue()
+    {
+        size_t index = this->head.load(std::memory_order_relaxed);
+        const size_t end = this->tail.load(std::memory_order_relaxed);
+        while (index != end)
+        {
+            this->GetSlot(index)->~T();
+            index = Wrap(index + 1);
+        }
+    }
+
+    template <typename T, size_t TNumElements, OverflowPolicy TOverflowPolicy>
+    bool SpscQueue<T, TNumElements, TOverflowPolicy>::TryPush(const T &element)
+    {
+        return this->TryPushElement(element);
+    }
+
+    template <typename T, size_t TNumElements, OverflowPolicy TOverflowPolicy>
+    bool SpscQueue<T, TNumElements, TOverflowPolicy>::TryPush(T &&element)
+    {
+        return this->TryPushElement(libEmbedded::move(element));
+    }
+
+    template <typename T, size_t TNumElements, OverflowPolicy TOverflowPolicy>
+    template <typename TElement>
+    bool SpscQueue<T, TNumElements, TOverflowPolicy>::TryPushElement(TElement &&element)
+    {
+        const size_t currentTail = this->tail.load(std::memory_order_relaxed);
+        const size_t nextTail = Wrap(currentTail + 1);
+        if (nextTail == this->cachedHead)
+        {
+            this->cachedHead = this->head.load(std::memory_order_acquire);
+            if (nextTail == this->cachedHead)
+            {
+                return false;
+            }
+        }
+        new (this->GetSlot(currentTail)) T(libEmbedded::forward<TElement>(element));
+        this->tail.store(nextTail, std::memory_order_release);
+        return true;
+    }
+
+    template <typename T, size_t TNumElements, OverflowPolicy TOverflowPolicy>
+    template <typename TRep, typename TPeriod>
+    bool SpscQueue<T, TNumElements, TOverflowPolicy>::Push(const T &element, const std::chrono::duration<TRep, TPeriod> &timeout)
+    {
+        static_assert(TOverflowPolicy == OverflowPolicy::BLOCK, "Push with a timeout needs OverflowPolicy::BLOCK, use TryPush otherwise.");
+        return this->waiter.WaitFor([this, &element]() { return this->TryPush(element); }, timeout);
+    }
+
+    template <typename T, size_t TNumElements, OverflowPolicy TOverflowPolicy>
+    size_t SpscQueue<T, TNumElements, TOverflowPolicy>::TryPushRange(const T *elements, size_t elementCount)
+    {
+        const size_t currentTail = this->tail.load(std::memory_order_relaxed);
+        size_t available = TNumElements - Used(this->cachedHead, currentTail);
+        if (available < elementCount)
+        {
+            this->cachedHead = this->head.load(std::memory_order_acquire);
+            available = TNumElements - Used(this->cachedHead, currentTail);
+        }
+        const size_t count = elementCount < available ? elementCount : available;
+        size_t index = currentTail;
+        for (size_t i = 0; i < count; i++)
+        {
+            new (this->GetSlot(index)) T(elements[i]);
+            index = Wrap(index + 1);
+        }
+        // Publish all elements at once.
+        this->tail.store(index, std::memory_order_release);
+        return count;
+    }
+
+    template <typename T, size_t TNumElements, OverflowPolicy TOverflowPolicy>
+    bool SpscQueue<T, TNumElements, TOverflowPolicy>::TryPop(T &element)
+    {
+        const size_t currentHead = this->head.load(std::memory_order_relaxed);
+        if (currentHead == this->cachedTail)
+        {
+            this->cachedTail = this->tail.load(std::memory_order_acquire);
+            if (currentHead == this->cachedTail)
+            {
+                return false;
+            }
+        }
+        T *slot = this->GetSlot(currentHead);
+        element = libEmbedded::move(*slot);
+        slot->~T();
+        this->head.store(Wrap(currentHead + 1), std::memory_order_release);
+        this->waiter.NotifySpaceFreed();
+        return true;
+    }
+
+    template <typename T, size_t TNumElements, OverflowPolicy TOverflowPolicy>
+    size_t SpscQueue<T, TNumElements, TOverflowPolicy>::TryPopRange(T *elements, size_t maxCount)
+    {
+        const size_t currentHead = this->head.load(std::memory_order_relaxed);
+        size_t used = Used(currentHead, this->cachedTail);
+        if (used < maxCount)
+        {
+            this->cachedTail = this->tail.load(std::memory_order_acquire);
+            used = Used(currentHead, this->cachedTail);
+        }
+        const size_t count = maxCount < used ? maxCount : used;
+        size_t index = currentHead;
+        for (size_t i = 0; i < count; i++)
+        {
+            T *slot = this->GetSlot(index);
+            elements[i] = libEmbedded::move(*slot);
+            slot->~T();
+            index = Wrap(index + 1);
+        }
+        // Release all slots at once.
+        this->head.store(index, std::memory_order_release);
+        if (count > 0)
+        {
+            this->waiter.NotifySpaceFreed();
+        }
+        return count;
+    }
+
+    template <typename T, size_t TNumElements, OverflowPolicy TOverflowPolicy>
+    size_t SpscQueue<T, TNumElements, TOverflowPolicy>::Size() const
+    {
+        // Tail first, the head can never pass the tail so the result stays in range.
+        const size_t currentTail = this->tail.load(std::memory_order_acquire);
+        return Used(this->head.load(std::memory_order_acquire), currentTail);
+    }
+
+    template <typename T, size_t TNumElements, OverflowPolicy TOverflowPolicy>
+    size_t SpscQueue<T, TNumElements, TOverflowPolicy>::Capacity() const
+    {
+        return TNumElements;
+    }
+
+    template <typename T, size_t TNumElements, OverflowPolicy TOverflowPolicy>
+    T *SpscQueue<T, TNumElements, TOverflowPolicy>::GetSlot(size_t index)
+    {
+        return reinterpret_cast<T *>(this->workspace.data) + index;
+    }
+} // namespace libEmbedded
+
+#endif // LIBEMBEDDED_SPSC_QUEUE_H
@@ -0,0 +1,212 @@
+/**
+ * @file StaticSpan.h
+ * @author Giel Willemsen
+ * @brief A Span of which the number of elements is known at compile time.
+ * @version 0.1 2026-10-17 Initial version
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * @details
+ * A StaticSpan only stores a pointer to the first element, the size is the TExtent template argument. So it is half
+ * the size of a Span, loops over it have a constant trip count (which the compiler can unroll) and a mismatch in
+ * size (passing a 4 byte array where a 6 byte MAC address is expected) is a compile error. Like the slicing of
+ * a Span, the compile time slices (First, Last, Subspan) are checked at compile time.
+ * A StaticSpan converts implicitly to the dynamic Span<T>, ToStaticSpan goes the other way.
+ */
+#pragma once
+#ifndef LIBEMBEDDED_STATIC_SPAN_H
+#define LIBEMBEDDED_STATIC_SPAN_H
+#include <stddef.h>
+#include "libEmbedded/TypeTrait.h"
+#include "libEmbedded/Span.h"
+
+namespace libEmbedded
+{
+    /**
+     * @brief A contiguous sequence of exactly TExtent elements.
+     *
+     * @tparam T The type of the element, const T for a readonly span.
+     * @tparam TExtent The number of elements.
+     */
+    template <typename T, size_t TExtent>
+    class StaticSpan
+    {
+    public:
+        using iterator = T *;
+        using const_iterator = const T *;
+
+        /**
+         * @brief The number of elements in the span.
+         *
+         */
+        static constexpr size_t kExtent = TExtent;
+
+    private:
+        T *spanStart;
+
+    public:
+        /**
+         * @brief Construct a new span over the TExtent elements starting at start.
+         * Only takes pointers, so a array of the wrong size can't decay into one.
+         *
+         * @tparam TPointer T* or (for a readonly span) a pointer to the modifiable T.
+         * @param start The first element, there must be at least TExtent elements from there on.
+         */
+        template <typename TPointer, typename = typename enable_if<is_same<typename remove_cv<typename remove_reference<TPointer>::type>::type, T *>::value || is_same<typename remove_cv<typename remove_reference<TPointer>::type>::type, typename remove_const<T>::type *>::value>::type>
+        constexpr explicit StaticSpan(TPointer &&start) : spanStart(start) {}
+
+        /**
+         * @brief Construct a new span over a array of exactly TExtent elements.
+         *
+         * @param array The array to span.
+         */
+        constexpr StaticSpan(T (&array)[TExtent]) : spanStart(array) {}
+
+        /**
+         * @brief Construct a readonly span from a modifiable one.
+         *
+         * @param span The span to create this one from.
+         */
+        template <typename U, typename = typename enable_if<is_same<const U, T>::value && !is_same<U, T>::value>::type>
+        constexpr StaticSpan(const StaticSpan<U, TExtent> &span) : spanStart(span.begin()) {}
+
+        /**
+         * @brief Retrieve a iterator to the start of the span.
+         *
+         * @return iterator The iterator at the start.
+         */
+        constexpr iterator begin() const
+        {
+            return this->spanStart;
+        }
+
+        /**
+         * @brief Retrieve a readonly iterator to the start of the span.
+         *
+         * @return const_iterator The iterator at the start that can only read the span.
+         */
+        constexpr const_iterator cbegin() const
+        {
+            return this->spanStart;
+        }
+
+        /**
+         * @brief Retrieve a iterator that is 1 passed the last item in the span.
+         *
+         * @return iterator The iterator one passed the last element in the span.
+         */
+        constexpr iterator end() const
+        {
+            return this->spanStart + TExtent;
+        }
+
+        /**
+         * @brief Retrieve a readonly iterator that is 1 passed the last item in the span.
+         *
+         * @return const_iterator The iterator one passed the last element that can only read the span.
+         */
+        constexpr const_iterator cend() const
+        {
+            return this->spanStart + TExtent;
+        }
+
+        /**
+         * @brief Returns the number of elements in the span.
+         *
+         * @return size_t TExtent.
+         */
+        static constexpr size_t Size()
+        {
+            return TExtent;
+        }
+
+        /**
+         * @brief Retrieve the item at the given index. Does not do any bounds checks!
+         *
+         * @param index The index to retrieve the item from.
+         * @return T& A reference to the item at the given index.
+         */
+        constexpr T &operator[](size_t index) const
+        {
+            return this->spanStart[index];
+        }
+
+        /**
+         * @brief Retrieve the first TCount elements, checked at compile time.
+         *
+         * @tparam TCount The number of elements.
+         * @return StaticSpan<T, TCount> The first TCount elements.
+         */
+        template <size_t TCount>
+        constexpr StaticSpan<T, TCount> First() const
+        {
+            static_assert(TCount <= TExtent, "Can't take more elements than there are in the span.");
+            return StaticSpan<T, TCount>(this->spanStart);
+        }
+
+        /**
+         * @brief Retrieve the last TCount elements, checked at compile time.
+         *
+         * @tparam TCount The number of elements.
+         * @return StaticSpan<T, TCount> The last TCount elements.
+         */
+        template <size_t TCount>
+        constexpr StaticSpan<T, TCount> Last() const
+        {
+            static_assert(TCount <= TExtent, "Can't take more elements than there are in the span.");
+            return StaticSpan<T, TCount>(this->spanStart + (TExtent - TCount));
+        }
+
+        /**
+         * @brief Retrieve TCount elements starting at TOffset, checked at compile time.
+         *
+         * @tparam TOffset The index of the first element.
+         * @tparam TCount The number of elements.
+         * @return StaticSpan<T, TCount> The elements.
+         */
+        template <size_t TOffset, size_t TCount>
+        constexpr StaticSpan<T, TCount> Subspan() const
+        {
+            static_assert(TOffset <= TExtent && TCount <= TExtent - TOffset, "The subspan must be within the span.");
+            return StaticSpan<T, TCount>(this->spanStart + TOffset);
+        }
+
+        /**
+         * @brief Convert to a span with a runtime size.
+         *
+         * @return Span<T> The same elements as a Span.
+         */
+        constexpr Span<T> AsSpan() const
+        {
+            return Span<T>(this->spanStart, this->spanStart + TExtent);
+        }
+
+        /**
+         * @brief Convert to a span with a runtime size.
+         *
+         * @return Span<T> The same elements as a Span.
+         */
+        constexpr operator Span<T>() const
+        {
+            return this->AsSpan();
+        }
+    };
+
+    /**
+     * @brief View the start of a Span as a StaticSpan. Does not do any bounds checks, the span must hold at least
+     * TExtent elements!
+     *
+     * @tparam TExtent The number of elements of the StaticSpan.
+     * @tparam T The type of the element.
+     * @param span The span to view.
+     * @return StaticSpan<T, TExtent> The first TExtent elements of the span.
+     */
+    template <size_t TExtent, typename T>
+    StaticSpan<T, TExtent> ToStaticSpan(Span<T> span)
+    {
+        return StaticSpan<T, TExtent>(span.begin());
+    }
+} // namespace libEmbedded
+
+#endif // LIBEMBEDDED_STATIC_SPAN_H
@@ -0,0 +1,275 @@
+/**
+ * @file StridedSpan.h
+ * @author Giel Willemsen
+ * @brief A span over every stride-th element of a array, for example a column of a image.
+ * @version 0.1 2026-10-17 Initial version
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * @details
+ * The elements of a StridedSpan are stride elements apart instead of next to each other. Its iterator is a random
+ * access iterator that keeps a index next to the start pointer, so a iterator is never moved past the end of the
+ * array (the end of a column is not a valid pointer, it would be up to a row past the end of the image).
+ */
+#pragma once
+#ifndef LIBEMBEDDED_STRIDED_SPAN_H
+#define LIBEMBEDDED_STRIDED_SPAN_H
+#include <stddef.h>
+#include "libEmbedded/TypeTrait.h"
+
+namespace libEmbedded
+{
+    /**
+     * @brief Random access iterator over elements that are stride elements apart.
+     *
+     * @tparam T The type of the element.
+     */
+    template <typename T>
+    class StridedIterator
+    {
+    public:
+        typedef random_access_iterator_tag iterator_category;
+        typedef T value_type;
+        typedef ptrdiff_t difference_type;
+        typedef T *pointer;
+        typedef T &reference;
+
+    private:
+        T *start;
+        ptrdiff_t stride;
+        ptrdiff_t index;
+
+    public:
+        constexpr StridedIterator(T *start, ptrdiff_t stride, ptrdiff_t index) : start(start), stride(stride), index(index) {}
+
+        T &operator*() const
+        {
+            return this->start[this->index * this->stride];
+        }
+
+        T *operator->() const
+        {
+            return &this->start[this->index * this->stride];
+        }
+
+        T &operator[](ptrdiff_t n) const
+        {
+            return this->start[(this->index + n) * this->stride];
+        }
+
+        StridedIterator &operator++()
+        {
+            this->index++;
+            return *this;
+        }
+
+        StridedIterator operator++(int)
+        {
+            StridedIterator old = *this;
+            this->index++;
+            return old;
+        }
+
+        StridedIterator &operator--()
+        {
+            this->index--;
+            return *this;
+        }
+
+        StridedIterator operator--(int)
+        {
+            StridedIterator old = *this;
+            this->index--;
+            return old;
+        }
+
+        StridedIterator &operator+=(ptrdiff_t n)
+        {
+            this->index += n;
+            return *this;
+        }
+
+        StridedIterator &operator-=(ptrdiff_t n)
+        {
+            this->index -= n;
+            return *this;
+        }
+
+        StridedIterator operator+(ptrdiff_t n) const
+        {
+            return StridedIterator(this->start, this->stride, this->index + n);
+        }
+
+        StridedIterator operator-(ptrdiff_t n) const
+        {
+            return StridedIterator(this->start, this->stride, this->index - n);
+        }
+
+        ptrdiff_t operator-(const StridedIterator &other) const
+        {
+            return this->index - other.index;
+        }
+
+        bool operator==(const StridedIterator &other) const
+        {
+            return this->index == other.index;
+        }
+
+        bool operator!=(const StridedIterator &other) const
+        {
+            return this->index != other.index;
+        }
+
+        bool operator<(const StridedIterator &other) const
+        {
+            return this->index < other.index;
+        }
+
+        bool operator>(const StridedIterator &other) const
+        {
+            return this->index > other.index;
+        }
+
+        bool operator<=(const StridedIterator &other) const
+        {
+            return this->index <= other.index;
+        }
+
+        bool operator>=(const StridedIterator &other) const
+        {
+            return this->index >= other.index;
+        }
+    };
+
+    /**
+     * @brief A sequence of size elements that are stride elements apart.
+     *
+     * @tparam T The type of the element, const T for a readonly span.
+     */
+    template <typename T>
+    class StridedSpan
+    {
+    public:
+        using iterator = StridedIterator<T>;
+        using const_iterator = StridedIterator<const T>;
+
+    private:
+        T *spanStart;
+        size_t size;
+        ptrdiff_t stride;
+
+    public:
+        /**
+         * @brief Construct a new strided span.
+         *
+         * @param start The first element.
+         * @param size The number of elements.
+         * @param stride The distance between two elements, in elements (1 is a normal Span).
+         */
+        constexpr StridedSpan(T *start, size_t size, ptrdiff_t stride) : spanStart(start), size(size), stride(stride) {}
+
+        /**
+         * @brief Construct a readonly span from a modifiable one.
+         *
+         * @param span The span to create this one from.
+         */
+        template <typename U, typename = typename enable_if<is_same<const U, T>::value && !is_same<U, T>::value>::type>
+        constexpr StridedSpan(const StridedSpan<U> &span) : spanStart(span.Data()), size(span.Size()), stride(span.Stride()) {}
+
+        /**
+         * @brief Retrieve a iterator to the first element.
+         *
+         * @return iterator The iterator at the start.
+         */
+        constexpr iterator begin() const
+        {
+            return iterator(this->spanStart, this->stride, 0);
+        }
+
+        /**
+         * @brief Retrieve a readonly iterator to the first element.
+         *
+         * @return const_iterator The iterator at the start that can only read the span.
+         */
+        constexpr const_iterator cbegin() const
+        {
+            return const_iterator(this->spanStart, this->stride, 0);
+        }
+
+        /**
+         * @brief Retrieve a iterator that is 1 passed the last element.
+         *
+         * @return iterator The iterator passed the last element.
+         */
+        constexpr iterator end() const
+        {
+            return iterator(this->spanStart, this->stride, static_cast<ptrdiff_t>(this->size));
+        }
+
+        /**
+         * @brief Retrieve a readonly iterator that is 1 passed the last element.
+         *
+         * @return const_iterator The iterator passed the last element that can only read the span.
+         */
+        constexpr const_iterator cend() const
+        {
+            return const_iterator(this->spanStart, this->stride, static_cast<ptrdiff_t>(this->size));
+        }
+
+        /**
+         * @brief Retrieve the item at the given index. Does not do any bounds checks!
+         *
+         * @param index The index to retrieve the item from.
+         * @return T& A reference to the item at the given index.
+         */
+        constexpr T &operator[](size_t index) const
+        {
+            return this->spanStart[static_cast<ptrdiff_t>(index) * this->stride];
+        }
+
+        /**
+         * @brief Returns the number of elements.
+         *
+         * @return size_t The number of elements.
+         */
+        constexpr size_t Size() const
+        {
+            return this->size;
+        }
+
+        /**
+         * @brief Returns the distance between two elements.
+         *
+         * @return ptrdiff_t The distance in elements.
+         */
+        constexpr ptrdiff_t Stride() const
+        {
+            return this->stride;
+        }
+
+        /**
+         * @brief Returns the first element.
+         *
+         * @return T* The first element.
+         */
+        constexpr T *Data() const
+        {
+            return this->spanStart;
+        }
+
+        /**
+         * @brief Retrieve count elements starting at offset as a new strided span. Does not do any bounds checks!
+         *
+         * @param offset The index of the first element.
+         * @param count The number of elements.
+         * @return StridedSpan<T> The subspan.
+         */
+        constexpr StridedSpan<T> Subspan(size_t offset, size_t count) const
+        {
+            return StridedSpan<T>(this->spanStart + static_cast<ptrdiff_t>(offset) * this->stride, count, this->stride);
+        }
+    };
+} // namespace libEmbedded
+
+#endif // LIBEMBEDDED_STRIDED_SPAN_H
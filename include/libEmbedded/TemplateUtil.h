@@ -3,13 +3,15 @@
  * @author Giel Willemsen
  * @brief Some helper types for dealing with Templates
  * @version 0.1
- * @date 2022-03-13
+ * @version 0.2 2026-10-17 Addition of At to retrieve the type at a index.
+ * @date 2026-10-17
  * 
  * @copyright Copyright (c) 2022
  * 
  */
 #ifndef LIBEMBEDDED_TEMPLATE_UTIL
 #define LIBEMBEDDED_TEMPLATE_UTIL
+#include <stddef.h>
 
 namespace libEmbedded
 {
@@ -56,6 +58,36 @@ namespace libEmbedded
              */
             using Type = T1;
         };
+
+        /**
+         * @brief Retrieve the type at the given index in the template list.
+         * 
+         */
+        template<size_t TIndex, class T1, class ...T>
+        struct At
+        {
+            static_assert(TIndex <= sizeof...(T), "TIndex must be smaller than the number of types.");
+
+            /**
+             * @brief The type itself.
+             * 
+             */
+            using Type = typename At<TIndex - 1, T...>::Type;
+        };
+
+        /**
+         * @brief Retrieve the type at the given index in the template list.
+         * 
+         */
+        template<class T1, class ...T>
+        struct At<0, T1, T...>
+        {
+            /**
+             * @brief The type itself.
+             * 
+             */
+            using Type = T1;
+        };
     } // namespace templateUtil
     
 } // namespace libEmbedded
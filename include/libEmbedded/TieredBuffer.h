@@ -0,0 +1,296 @@
+/**
+ * @file TieredBuffer.h
+ * @author Giel Willemsen
+ * @brief A chain of Buffers with a decreasing resolution, like a round-robin database (RRD).
+ * @version 0.1 2026-10-17 Initial version
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * @details
+ * New samples go into the first (finest) tier. The samples that are dropped from a full tier are not lost but fed
+ * into a reducer, and every TFactor of them are reduced (mean, min, max or last) into one sample of the next tier.
+ * So each tier holds the history just before the history of the tier in front of it, at a lower resolution.
+ * For example Tier<1000>, Tier<600, 100>, Tier<3600, 10> fed at 1 kHz holds the last second at 1 kHz, the minute
+ * before that at 10 Hz and the hour before that at 1 Hz. Everything is sized at compile time and every Add does at
+ * most one Buffer Add and one reducer step per tier.
+ */
+#pragma once
+#ifndef LIBEMBEDDED_TIERED_BUFFER_H
+#define LIBEMBEDDED_TIERED_BUFFER_H
+#include <stddef.h>
+#include "libEmbedded/TypeTrait.h"
+#include "libEmbedded/TemplateUtil.h"
+#include "libEmbedded/Buffer.h"
+
+namespace libEmbedded
+{
+    /**
+     * @brief The size of one tier of a TieredBuffer.
+     *
+     * @tparam TNumElements The number of samples in the tier.
+     * @tparam TFactor The number of samples dropped from the previous tier that are reduced into one sample of this tier
+     * (ignored for the first tier).
+     */
+    template <size_t TNumElements, size_t TFactor = 1>
+    struct Tier
+    {
+        static_assert(TNumElements > 0, "A tier needs at least one sample.");
+        static_assert(TFactor > 0, "The factor of a tier must be at least one.");
+
+        static constexpr size_t kNumElements = TNumElements;
+        static constexpr size_t kFactor = TFactor;
+    };
+
+    /**
+     * @brief Reduces samples to their mean.
+     *
+     * @tparam T The type of the samples.
+     * @tparam TAccumulator The type the sum is kept in.
+     */
+    template <typename T, typename TAccumulator = double>
+    class MeanReducer
+    {
+    private:
+        TAccumulator sum;
+        size_t count;
+
+    public:
+        MeanReducer() : sum(0), count(0) {}
+
+        void Accumulate(const T &value)
+        {
+            this->sum += static_cast<TAccumulator>(value);
+            this->count++;
+        }
+
+        T Result() const
+        {
+            return static_cast<T>(this->sum / static_cast<TAccumulator>(this->count));
+        }
+
+        void Reset()
+        {
+            this->sum = 0;
+            this->count = 0;
+        }
+    };
+
+    /**
+     * @brief Reduces samples to the smallest one.
+     *
+     * @tparam T The type of the samples.
+     */
+    template <typename T>
+    class MinReducer
+    {
+    private:
+        T minimum;
+        bool empty;
+
+    public:
+        MinReducer() : minimum(), empty(true) {}
+
+        void Accumulate(const T &value)
+        {
+            if (this->empty || value < this->minimum)
+            {
+                this->minimum = value;
+                this->empty = false;
+            }
+        }
+
+        T Result() const
+        {
+            return this->minimum;
+        }
+
+        void Reset()
+        {
+            this->empty = true;
+        }
+    };
+
+    /**
+     * @brief Reduces samples to the largest one.
+     *
+     * @tparam T The type of the samples.
+     */
+    template <typename T>
+    class MaxReducer
+    {
+    private:
+        T maximum;
+        bool empty;
+
+    public:
+        MaxReducer() : maximum(), empty(true) {}
+
+        void Accumulate(const T &value)
+        {
+            if (this->empty || this->maximum < value)
+            {
+                this->maximum = value;
+                this->empty = false;
+            }
+        }
+
+        T Result() const
+        {
+            return this->maximum;
+        }
+
+        void Reset()
+        {
+            this->empty = true;
+        }
+    };
+
+    /**
+     * @brief Reduces samples to the newest one (downsampling without filtering).
+     *
+     * @tparam T The type of the samples.
+     */
+    template <typename T>
+    class LastReducer
+    {
+    private:
+        T last;
+
+    public:
+        LastReducer() : last() {}
+
+        void Accumulate(const T &value)
+        {
+            this->last = value;
+        }
+
+        T Result() const
+        {
+            return this->last;
+        }
+
+        void Reset()
+        {
+        }
+    };
+
+    template <typename T, typename TReducer, typename... TTiers>
+    class TierChain;
+
+    /**
+     * @brief The last tier of a TieredBuffer, samples dropped from it are gone.
+     *
+     */
+    template <typename T, typename TReducer, typename TTier>
+    class TierChain<T, TReducer, TTier>
+    {
+    private:
+        Buffer<T, TTier::kNumElements> samples;
+
+    public:
+        void Add(const T &value)
+        {
+            this->samples.Add(value);
+        }
+
+        const Buffer<T, TTier::kNumElements> &GetTier(integral_constant<size_t, 0>) const
+        {
+            return this->samples;
+        }
+    };
+
+    /**
+     * @brief A tier of a TieredBuffer followed by at least one coarser tier.
+     *
+     */
+    template <typename T, typename TReducer, typename TTier, typename TNext, typename... TRest>
+    class TierChain<T, TReducer, TTier, TNext, TRest...>
+    {
+    private:
+        Buffer<T, TTier::kNumElements> samples;
+        // The samples dropped from this tier that are not yet reduced into the next tier.
+        TReducer reducer;
+        size_t reducedCount;
+        TierChain<T, TReducer, TNext, TRest...> next;
+
+    public:
+        TierChain() : samples(), reducer(), reducedCount(0), next() {}
+
+        void Add(const T &value)
+        {
+            if (this->samples.Size() == TTier::kNumElements)
+            {
+                this->reducer.Accumulate(this->samples[0]);
+                this->reducedCount++;
+                if (this->reducedCount == TNext::kFactor)
+                {
+                    this->next.Add(this->reducer.Result());
+                    this->reducer.Reset();
+                    this->reducedCount = 0;
+                }
+            }
+            this->samples.Add(value);
+        }
+
+        const Buffer<T, TTier::kNumElements> &GetTier(integral_constant<size_t, 0>) const
+        {
+            return this->samples;
+        }
+
+        template <size_t TIndex>
+        const Buffer<T, templateUtil::At<TIndex, TTier, TNext, TRest...>::Type::kNumElements> &GetTier(integral_constant<size_t, TIndex>) const
+        {
+            return this->next.GetTier(integral_constant<size_t, TIndex - 1>());
+        }
+    };
+
+    /**
+     * @brief Buffer that keeps a long history in a bounded footprint by downsampling older samples into coarser tiers.
+     *
+     * @tparam T The type of the samples.
+     * @tparam TReducer How samples are reduced into a sample of the next tier: MeanReducer<T>, MinReducer<T>,
+     * MaxReducer<T>, LastReducer<T> or any class with Accumulate(const T&), T Result() and Reset().
+     * @tparam TTiers The tiers from fine to coarse, each a Tier<TNumElements, TFactor>.
+     */
+    template <typename T, typename TReducer, typename... TTiers>
+    class TieredBuffer
+    {
+        static_assert(sizeof...(TTiers) > 0, "A TieredBuffer needs at least one tier.");
+
+    private:
+        TierChain<T, TReducer, TTiers...> tiers;
+
+    public:
+        /**
+         * @brief The number of tiers.
+         *
+         */
+        static constexpr size_t kTierCount = sizeof...(TTiers);
+
+        /**
+         * @brief Add a sample to the first tier, older samples move down the tiers.
+         *
+         * @param value The sample to add.
+         */
+        void Add(const T &value)
+        {
+            this->tiers.Add(value);
+        }
+
+        /**
+         * @brief Get the samples of a tier, oldest first. Tier 0 has the newest samples at the highest resolution.
+         *
+         * @tparam TIndex The index of the tier.
+         * @return const Buffer<T, TNumElements>& The samples in the tier.
+         */
+        template <size_t TIndex>
+        const Buffer<T, templateUtil::At<TIndex, TTiers...>::Type::kNumElements> &GetTier() const
+        {
+            static_assert(TIndex < sizeof...(TTiers), "TIndex must be smaller than the number of tiers.");
+            return this->tiers.GetTier(integral_constant<size_t, TIndex>());
+        }
+    };
+} // namespace libEmbedded
+
+#endif // LIBEMBEDDED_TIERED_BUFFER_H
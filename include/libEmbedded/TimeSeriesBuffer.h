@@ -0,0 +1,574 @@
+/**
+ * @file TimeSeriesBuffer.h
+ * @author Giel Willemsen
+ * @brief A append-only ring of timestamped doubles, compressed in blocks like Facebook's Gorilla time series database.
+ * @version 0.1 2026-10-17 Initial version
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * @details
+ * Each block starts with the first point as is (64 bit timestamp, 64 bit double). Every point after it is stored as:
+ * - The delta-of-delta of the timestamp, zigzag encoded. A control code of 0 to 4 one bits closed by a zero bit
+ *   (4 ones are not closed) tells the size: 0 (nothing follows), 7, 9, 12 or 64 bits. A fixed sample rate costs 1 bit.
+ * - The value XOR'ed with the value before it. A 0 bit when the value did not change. Otherwise a 1 bit followed by a
+ *   0 bit and the meaningful bits when they fit in the leading and trailing zeros of the previous XOR, or a 1 bit,
+ *   5 bits leading zeros, 6 bits length and the meaningful bits when they don't.
+ * Bits are written LSB first into 64 bit words. When all blocks are full the oldest block is dropped as a whole.
+ * Reading is sequential only, through the decoding iterator.
+ */
+#pragma once
+#ifndef LIBEMBEDDED_TIME_SERIES_BUFFER_H
+#define LIBEMBEDDED_TIME_SERIES_BUFFER_H
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include "libEmbedded/Buffer.h"
+#include "libEmbedded/bits/Combining.h"
+#include "libEmbedded/bits/Extracting.h"
+#include "libEmbedded/bits/Util.h"
+
+namespace libEmbedded
+{
+    /**
+     * @brief A point of a time series.
+     *
+     */
+    struct TimeSeriesPoint
+    {
+        uint64_t timestamp;
+        double value;
+    };
+
+    /**
+     * @brief Compressed ring of timestamped doubles that drops the oldest block of points when it is full.
+     * NOTE: The compression depends on the data, a fixed sample rate and a value that often repeats or only changes in
+     * a few mantissa bits compress best. Timestamps don't have to increase, but jumps cost more bits.
+     *
+     * @tparam TNumBlocks The number of blocks, a power of two is the fastest.
+     * @tparam TBlockSize The size of one block in bytes, a multiple of 8. Larger blocks compress better (the first
+     * point of each block is stored uncompressed), smaller blocks drop fewer points at a time.
+     */
+    template <size_t TNumBlocks, size_t TBlockSize = 256>
+    class TimeSeriesBuffer
+    {
+        static_assert(TNumBlocks > 0, "A TimeSeriesBuffer needs at least one block.");
+        static_assert(TBlockSize % sizeof(uint64_t) == 0, "The block size must be a multiple of 8 bytes.");
+        static_assert(TBlockSize >= 2 * sizeof(uint64_t), "A block must be able to hold at least one point.");
+        static_assert(TBlockSize * CHAR_BIT / 2 <= UINT16_MAX, "The number of points in a block is kept in a uint16_t.");
+
+    private:
+        static constexpr size_t kWordsPerBlock = TBlockSize / sizeof(uint64_t);
+        static constexpr size_t kBitsPerBlock = TBlockSize * CHAR_BIT;
+        // Leading zero count that forces the next XOR to store its own window.
+        static constexpr uint8_t kNoWindow = 64;
+
+        /**
+         * @brief What is needed to encode or decode the next point of a block.
+         *
+         */
+        struct State
+        {
+            uint64_t timestamp;
+            uint64_t delta;
+            uint64_t valueBits;
+            uint8_t leading;
+            uint8_t trailing;
+        };
+
+    public:
+        /**
+         * @brief Readonly iterator that decodes the points, oldest first.
+         * Adding to the buffer invalidates all iterators.
+         *
+         */
+        class ConstIterator
+        {
+        private:
+            const TimeSeriesBuffer<TNumBlocks, TBlockSize> *buffer;
+            // Index of the point in the buffer, used for comparing iterators.
+            size_t position;
+            // Index of the current block, counted from the oldest block.
+            size_t block;
+            const uint64_t *words;
+            // Bit offset of the next encoded point in the current block.
+            size_t bitOffset;
+            // Number of points in the current block after the current one.
+            size_t remaining;
+            State state;
+            TimeSeriesPoint point;
+
+        public:
+            ConstIterator(const TimeSeriesBuffer<TNumBlocks, TBlockSize> *buffer, size_t position)
+                : buffer(buffer), position(position), block(0), words(nullptr), bitOffset(0), remaining(0), state(), point()
+            {
+                if (position == 0 && buffer->size > 0)
+                {
+                    this->LoadBlock(0);
+                }
+            }
+
+            const TimeSeriesPoint &operator*() const
+            {
+                return this->point;
+            }
+
+            const TimeSeriesPoint *operator->() const
+            {
+                return &this->point;
+            }
+
+            ConstIterator &operator++()
+            {
+                this->position++;
+                if (this->remaining > 0)
+                {
+                    this->remaining--;
+                    Decode(this->words, this->bitOffset, this->state);
+                    this->UpdatePoint();
+                }
+                else if (this->block + 1 < this->buffer->blockCount)
+                {
+                    this->LoadBlock(this->block + 1);
+                }
+                return *this;
+            }
+
+            ConstIterator operator++(int)
+            {
+                ConstIterator old = *this;
+                ++(*this);
+                return old;
+            }
+
+            bool operator==(const ConstIterator &other) const
+            {
+                return this->position == other.position;
+            }
+
+            bool operator!=(const ConstIterator &other) const
+            {
+                return !(*this == other);
+            }
+
+        private:
+            void LoadBlock(size_t block)
+            {
+                this->block = block;
+                const size_t index = this->buffer->GetBlockIndex(block);
+                this->words = this->buffer->blocks[index];
+                this->bitOffset = 0;
+                this->remaining = this->buffer->counts[index] - 1;
+                DecodeFirst(this->words, this->bitOffset, this->state);
+                this->UpdatePoint();
+            }
+
+            void UpdatePoint()
+            {
+                this->point.timestamp = this->state.timestamp;
+                memcpy(&this->point.value, &this->state.valueBits, sizeof(double));
+            }
+        };
+
+        typedef ConstIterator const_iterator;
+
+    private:
+        uint64_t blocks[TNumBlocks][kWordsPerBlock];
+        // Number of points per block.
+        uint16_t counts[TNumBlocks];
+        size_t firstBlock;
+        size_t blockCount;
+        // Number of bits used in the newest block.
+        size_t bitsUsed;
+        size_t size;
+        // Encoder state after the newest point.
+        State last;
+
+    public:
+        /**
+         * @brief Construct a new empty buffer.
+         *
+         */
+        TimeSeriesBuffer() : firstBlock(0), blockCount(0), bitsUsed(0), size(0), last() {}
+
+        /**
+         * @brief Add a point to the back of the buffer, dropping the oldest block when there is no room left.
+         *
+         * @param timestamp The timestamp of the point.
+         * @param value The value of the point.
+         */
+        void Add(uint64_t timestamp, double value);
+
+        /**
+         * @brief Drop the oldest block of points.
+         *
+         * @return size_t The number of points dropped, 0 for an empty buffer.
+         */
+        size_t RemoveBlock();
+
+        /**
+         * @brief Remove all points.
+         *
+         */
+        void Clear();
+
+        /**
+         * @brief Returns the number of points in the buffer.
+         *
+         * @return size_t The number of points.
+         */
+        size_t Size() const;
+
+        /**
+         * @brief Returns the number of blocks in use.
+         *
+         * @return size_t The number of blocks in use.
+         */
+        size_t BlockCount() const;
+
+        /**
+         * @brief Returns the number of bytes of storage in use, the unused bits at the end of a older block included.
+         *
+         * @return size_t The number of bytes in use, at most TNumBlocks * TBlockSize.
+         */
+        size_t BytesUsed() const;
+
+        /**
+         * @brief Returns the newest point.
+         * Warning: The buffer may not be empty!
+         *
+         * @return TimeSeriesPoint The newest point.
+         */
+        TimeSeriesPoint Back() const;
+
+        /**
+         * @brief Retrieve a iterator that decodes from the oldest point.
+         *
+         * @return const_iterator The iterator at the oldest point.
+         */
+        const_iterator begin() const;
+
+        /**
+         * @brief Retrieve a iterator to the end of the buffer.
+         *
+         * @return const_iterator The iterator one past the newest point.
+         */
+        const_iterator end() const;
+
+    private:
+        static constexpr size_t Wrap(size_t index)
+        {
+            return BufferIndex<TNumBlocks>::Wrap(index);
+        }
+
+        size_t GetBlockIndex(size_t block) const
+        {
+            return Wrap(this->firstBlock + block);
+        }
+
+        static uint64_t ZigZag(uint64_t value)
+        {
+            return (value << 1) ^ (0 - (value >> 63));
+        }
+
+        static uint64_t UnZigZag(uint64_t value)
+        {
+            return (value >> 1) ^ (0 - (value & 1));
+        }
+
+        /**
+         * @brief Returns the number of control ones (0 to 4) for a zigzag encoded delta-of-delta.
+         *
+         */
+        static size_t GetTimestampClass(uint64_t encoded)
+        {
+            return encoded == 0 ? 0 : encoded < ((uint64_t)1 << 7) ? 1 : encoded < ((uint64_t)1 << 9) ? 2 : encoded < ((uint64_t)1 << 12) ? 3 : 4;
+        }
+
+        static constexpr size_t GetTimestampBits(size_t timestampClass)
+        {
+            return timestampClass == 0 ? 0 : timestampClass == 1 ? 7 : timestampClass == 2 ? 9 : timestampClass == 3 ? 12 : 64;
+        }
+
+        static void WriteBits(uint64_t *words, size_t &bitOffset, uint64_t value, size_t count);
+
+        static uint64_t ReadBits(const uint64_t *words, size_t &bitOffset, size_t count);
+
+        /**
+         * @brief Encode a point after the one in state, or only return the number of bits when words is nullptr.
+         *
+         */
+        static size_t Encode(uint64_t *words, size_t &bitOffset, State &state, uint64_t timestamp, uint64_t valueBits);
+
+        static void EncodeFirst(uint64_t *words, size_t &bitOffset, State &state, uint64_t timestamp, uint64_t valueBits);
+
+        static void Decode(const uint64_t *words, size_t &bitOffset, State &state);
+
+        static void DecodeFirst(const uint64_t *words, size_t &bitOffset, State &state);
+    };
+
+    template <size_t TNumBlocks, size_t TBlockSize>
+    void TimeSeriesBuffer<TNumBlocks, TBlockSize>::Add(uint64_t timestamp, double value)
+    {
+        uint64_t valueBits;
+        memcpy(&valueBits, &value, sizeof(double));
+        if (this->blockCount > 0)
+        {
+            State state = this->last;
+            size_t bitOffset = this->bitsUsed;
+            const size_t bitCount = Encode(nullptr, bitOffset, state, timestamp, valueBits);
+            if (this->bitsUsed + bitCount <= kBitsPerBlock)
+            {
+                const size_t index = this->GetBlockIndex(this->blockCount - 1);
+                Encode(this->blocks[index], this->bitsUsed, this->last, timestamp, valueBits);
+                this->counts[index]++;
+                this->size++;
+                return;
+            }
+        }
+        if (this->blockCount == TNumBlocks)
+        {
+            this->RemoveBlock();
+        }
+        const size_t index = this->GetBlockIndex(this->blockCount);
+        this->blockCount++;
+        this->bitsUsed = 0;
+        EncodeFirst(this->blocks[index], this->bitsUsed, this->last, timestamp, valueBits);
+        this->counts[index] = 1;
+        this->size++;
+    }
+
+    template <size_t TNumBlocks, size_t TBlockSize>
+    size_t TimeSeriesBuffer<TNumBlocks, TBlockSize>::RemoveBlock()
+    {
+        if (this->blockCount == 0)
+        {
+            return 0;
+        }
+        const size_t dropped = this->counts[this->firstBlock];
+        this->firstBlock = Wrap(this->firstBlock + 1);
+        this->blockCount--;
+        this->size -= dropped;
+        if (this->blockCount == 0)
+        {
+            this->bitsUsed = 0;
+        }
+        return dropped;
+    }
+
+    template <size_t TNumBlocks, size_t TBlockSize>
+    void TimeSeriesBuffer<TNumBlocks, TBlockSize>::Clear()
+    {
+        this->firstBlock = 0;
+        this->blockCount = 0;
+        this->bitsUsed = 0;
+        this->size = 0;
+    }
+
+    template <size_t TNumBlocks, size_t TBlockSize>
+    size_t TimeSeriesBuffer<TNumBlocks, TBlockSize>::Size() const
+    {
+        return this->size;
+    }
+
+    template <size_t TNumBlocks, size_t TBlockSize>
+    size_t TimeSeriesBuffer<TNumBlocks, TBlockSize>::BlockCount() const
+    {
+        return this->blockCount;
+    }
+
+    template <size_t TNumBlocks, size_t TBlockSize>
+    size_t TimeSeriesBuffer<TNumBlocks, TBlockSize>::BytesUsed() const
+    {
+        return this->blockCount == 0 ? 0 : (this->blockCount - 1) * TBlockSize + (this->bitsUsed + CHAR_BIT - 1) / CHAR_BIT;
+    }
+
+    template <size_t TNumBlocks, size_t TBlockSize>
+    TimeSeriesPoint TimeSeriesBuffer<TNumBlocks, TBlockSize>::Back() const
+    {
+        TimeSeriesPoint point;
+        point.timestamp = this->last.timestamp;
+        memcpy(&point.value, &this->last.valueBits, sizeof(double));
+        return point;
+    }
+
+    template <size_t TNumBlocks, size_t TBlockSize>
+    typename TimeSeriesBuffer<TNumBlocks, TBlockSize>::const_iterator TimeSeriesBuffer<TNumBlocks, TBlockSize>::begin() const
+    {
+        return const_iterator(this, 0);
+    }
+
+    template <size_t TNumBlocks, size_t TBlockSize>
+    typename TimeSeriesBuffer<TNumBlocks, TBlockSize>::const_iterator TimeSeriesBuffer<TNumBlocks, TBlockSize>::end() const
+    {
+        return const_iterator(this, this->size);
+    }
+
+    template <size_t TNumBlocks, size_t TBlockSize>
+    void TimeSeriesBuffer<TNumBlocks, TBlockSize>::WriteBits(uint64_t *words, size_t &bitOffset, uint64_t value, size_t count)
+    {
+        uint64_t *word = &words[bitOffset / 64];
+        const size_t start = bitOffset % 64;
+        const size_t first = count < 64 - start ? count : 64 - start;
+        *word = bits::SetBits(*word, value, start, first);
+        if (count > first)
+        {
+            word[1] = bits::SetBits(word[1], value >> first, 0, count - first);
+        }
+        bitOffset += count;
+    }
+
+    template <size_t TNumBlocks, size_t TBlockSize>
+    uint64_t TimeSeriesBuffer<TNumBlocks, TBlockSize>::ReadBits(const uint64_t *words, size_t &bitOffset, size_t count)
+    {
+        const uint64_t *word = &words[bitOffset / 64];
+        const size_t start = bitOffset % 64;
+        const size_t first = count < 64 - start ? count : 64 - start;
+        uint64_t value = bits::ExtractBits(*word, start, first);
+        if (count > first)
+        {
+            value |= bits::ExtractBits(word[1], 0, count - first) << first;
+        }
+        bitOffset += count;
+        return value;
+    }
+
+    template <size_t TNumBlocks, size_t TBlockSize>
+    size_t TimeSeriesBuffer<TNumBlocks, TBlockSize>::Encode(uint64_t *words, size_t &bitOffset, State &state, uint64_t timestamp, uint64_t valueBits)
+    {
+        const size_t started = bitOffset;
+        // Timestamp: control ones closed by a zero (except for the largest class), then the delta-of-delta.
+        const uint64_t delta = timestamp - state.timestamp;
+        const uint64_t encoded = ZigZag(delta - state.delta);
+        const size_t timestampClass = GetTimestampClass(encoded);
+        const size_t controlBits = timestampClass < 4 ? timestampClass + 1 : 4;
+        if (words == nullptr)
+        {
+            bitOffset += controlBits + GetTimestampBits(timestampClass);
+        }
+        else
+        {
+            WriteBits(words, bitOffset, ((uint64_t)1 << timestampClass) - 1, controlBits);
+            if (timestampClass != 0)
+            {
+                WriteBits(words, bitOffset, encoded, GetTimestampBits(timestampClass));
+            }
+        }
+
+        // Value: the XOR with the previous value.
+        const uint64_t xored = valueBits ^ state.valueBits;
+        size_t leading = state.leading;
+        size_t trailing = state.trailing;
+        if (xored == 0)
+        {
+            if (words == nullptr)
+            {
+                bitOffset += 1;
+            }
+            else
+            {
+                WriteBits(words, bitOffset, 0, 1);
+            }
+        }
+        else
+        {
+            const size_t newLeading = bits::CountLeadingZeros(xored);
+            const size_t newTrailing = bits::CountTrailingZeros(xored);
+            if (leading != kNoWindow && newLeading >= leading && newTrailing >= trailing)
+            {
+                // Fits in the window of the previous XOR.
+                const size_t meaningful = 64 - leading - trailing;
+                if (words == nullptr)
+                {
+                    bitOffset += 2 + meaningful;
+                }
+                else
+                {
+                    WriteBits(words, bitOffset, 0x1, 2);
+                    WriteBits(words, bitOffset, xored >> trailing, meaningful);
+                }
+            }
+            else
+            {
+                // The leading zeros are stored in 5 bits.
+                leading = newLeading > 31 ? 31 : newLeading;
+                trailing = newTrailing;
+                const size_t meaningful = 64 - leading - trailing;
+                if (words == nullptr)
+                {
+                    bitOffset += 2 + 5 + 6 + meaningful;
+                }
+                else
+                {
+                    WriteBits(words, bitOffset, 0x3, 2);
+                    WriteBits(words, bitOffset, leading, 5);
+                    // A length of 64 is stored as 0.
+                    WriteBits(words, bitOffset, meaningful, 6);
+                    WriteBits(words, bitOffset, xored >> trailing, meaningful);
+                }
+            }
+        }
+
+        if (words != nullptr)
+        {
+            state.timestamp = timestamp;
+            state.delta = delta;
+            state.valueBits = valueBits;
+            state.leading = static_cast<uint8_t>(leading);
+            state.trailing = static_cast<uint8_t>(trailing);
+        }
+        return bitOffset - started;
+    }
+
+    template <size_t TNumBlocks, size_t TBlockSize>
+    void TimeSeriesBuffer<TNumBlocks, TBlockSize>::EncodeFirst(uint64_t *words, size_t &bitOffset, State &state, uint64_t timestamp, uint64_t valueBits)
+    {
+        WriteBits(words, bitOffset, timestamp, 64);
+        WriteBits(words, bitOffset, valueBits, 64);
+        state.timestamp = timestamp;
+        state.delta = 0;
+        state.valueBits = valueBits;
+        state.leading = kNoWindow;
+        state.trailing = 0;
+    }
+
+    template <size_t TNumBlocks, size_t TBlockSize>
+    void TimeSeriesBuffer<TNumBlocks, TBlockSize>::Decode(const uint64_t *words, size_t &bitOffset, State &state)
+    {
+        size_t timestampClass = 0;
+        while (timestampClass < 4 && ReadBits(words, bitOffset, 1) != 0)
+        {
+            timestampClass++;
+        }
+        if (timestampClass != 0)
+        {
+            state.delta += UnZigZag(ReadBits(words, bitOffset, GetTimestampBits(timestampClass)));
+        }
+        state.timestamp += state.delta;
+
+        if (ReadBits(words, bitOffset, 1) == 0)
+        {
+            return;
+        }
+        if (ReadBits(words, bitOffset, 1) != 0)
+        {
+            state.leading = static_cast<uint8_t>(ReadBits(words, bitOffset, 5));
+            const size_t meaningful = static_cast<size_t>(ReadBits(words, bitOffset, 6));
+            state.trailing = static_cast<uint8_t>(64 - state.leading - (meaningful == 0 ? 64 : meaningful));
+        }
+        const size_t meaningful = 64 - state.leading - state.trailing;
+        state.valueBits ^= ReadBits(words, bitOffset, meaningful) << state.trailing;
+    }
+
+    template <size_t TNumBlocks, size_t TBlockSize>
+    void TimeSeriesBuffer<TNumBlocks, TBlockSize>::DecodeFirst(const uint64_t *words, size_t &bitOffset, State &state)
+    {
+        state.timestamp = ReadBits(words, bitOffset, 64);
+        state.valueBits = ReadBits(words, bitOffset, 64);
+        state.delta = 0;
+        state.leading = kNoWindow;
+        state.trailing = 0;
+    }
+} // namespace libEmbedded
+
+#endif // LIBEMBEDDED_TIME_SERIES_BUFFER_H
@@ -0,0 +1,166 @@
+/**
+ * @file TripleBuffer.h
+ * @author Giel Willemsen
+ * @brief Wait-free handoff of the latest value from one writer thread to one reader thread.
+ * @version 0.1 2026-10-17 Initial version
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * @details
+ * There are three slots: the writer owns the back slot, the reader owns the front slot and the middle slot is shared.
+ * Publishing swaps the back slot with the middle slot and marks the middle slot as fresh, taking the newest value
+ * swaps the front slot with a fresh middle slot. Both swaps are a single atomic exchange, so neither side ever waits
+ * for the other and a slot is never written while it is read. Values that are published but never taken are simply
+ * overwritten, the reader always gets the newest complete value.
+ */
+#pragma once
+#ifndef LIBEMBEDDED_TRIPLE_BUFFER_H
+#define LIBEMBEDDED_TRIPLE_BUFFER_H
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+#include "libEmbedded/Helpers.h"
+
+namespace libEmbedded
+{
+    /**
+     * @brief Latest value handoff between a single writer thread and a single reader thread.
+     *
+     * @tparam T The type of the value, default constructible (the reader sees a default constructed value until the
+     * first Publish).
+     */
+    template <typename T>
+    class TripleBuffer
+    {
+    private:
+        // The shared index is a slot index plus this flag when the slot holds a value the reader did not take yet.
+        static constexpr uint8_t kFresh = 0x4;
+        static constexpr uint8_t kIndexMask = 0x3;
+
+        /**
+         * @brief A slot on its own cache line, so the writer and the reader never share a line.
+         *
+         */
+        struct alignas(kCacheLineSize) Slot
+        {
+            T value;
+        };
+
+        Slot slots[3];
+        alignas(kCacheLineSize) std::atomic<uint8_t> middle;
+        // Only touched by the writer.
+        alignas(kCacheLineSize) uint8_t back;
+        // Only touched by the reader.
+        alignas(kCacheLineSize) uint8_t front;
+
+    public:
+        /**
+         * @brief Construct a new triple buffer, all slots default constructed.
+         *
+         */
+        TripleBuffer() : slots(), middle(1), back(0), front(2) {}
+
+        /**
+         * @brief The buffer is shared between threads, so copying it makes no sense.
+         *
+         */
+        TripleBuffer(const TripleBuffer<T> &) = delete;
+
+        /**
+         * @brief The buffer is shared between threads, so copying it makes no sense.
+         *
+         */
+        TripleBuffer<T> &operator=(const TripleBuffer<T> &) = delete;
+
+        /**
+         * @brief The slot to build the next value in, it still holds a older value. Writer thread only.
+         *
+         * @return T& The back slot.
+         */
+        T &Back();
+
+        /**
+         * @brief Hand the back slot to the reader as the newest value. Writer thread only.
+         * Afterwards Back is a other slot.
+         *
+         */
+        void Publish();
+
+        /**
+         * @brief Copy the value into the back slot and publish it. Writer thread only.
+         *
+         * @param value The new value.
+         */
+        void Write(const T &value);
+
+        /**
+         * @brief Take the newest published value if there is one. Reader thread only.
+         *
+         * @return true If Front changed to a newer value.
+         * @return false If nothing was published since the last Update, Front is unchanged.
+         */
+        bool Update();
+
+        /**
+         * @brief The value taken by the last Update. Reader thread only.
+         *
+         * @return const T& The front slot, it stays valid and unchanged until the next Update.
+         */
+        const T &Front() const;
+
+        /**
+         * @brief Take the newest published value (if there is one) and return it. Reader thread only.
+         *
+         * @return const T& The newest value, it stays valid and unchanged until the next Read or Update.
+         */
+        const T &Read();
+    };
+
+    template <typename T>
+    T &TripleBuffer<T>::Back()
+    {
+        return this->slots[this->back].value;
+    }
+
+    template <typename T>
+    void TripleBuffer<T>::Publish()
+    {
+        // Release the written value, acquire the slot the reader handed back.
+        this->back = this->middle.exchange(static_cast<uint8_t>(this->back | kFresh), std::memory_order_acq_rel) & kIndexMask;
+    }
+
+    template <typename T>
+    void TripleBuffer<T>::Write(const T &value)
+    {
+        this->Back() = value;
+        this->Publish();
+    }
+
+    template <typename T>
+    bool TripleBuffer<T>::Update()
+    {
+        if ((this->middle.load(std::memory_order_relaxed) & kFresh) == 0)
+        {
+            return false;
+        }
+        // Only the reader clears the fresh flag, so the middle slot is still fresh here.
+        this->front = this->middle.exchange(this->front, std::memory_order_acq_rel) & kIndexMask;
+        return true;
+    }
+
+    template <typename T>
+    const T &TripleBuffer<T>::Front() const
+    {
+        return this->slots[this->front].value;
+    }
+
+    template <typename T>
+    const T &TripleBuffer<T>::Read()
+    {
+        this->Update();
+        return this->Front();
+    }
+} // namespace libEmbedded
+
+#endif // LIBEMBEDDED_TRIPLE_BUFFER_H
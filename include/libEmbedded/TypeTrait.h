@@ -5,7 +5,10 @@
  * @version 0.1 2022-10-23 Initial version
  * @version 0.2 2022-10-27 If you try to reimplement the std don't depend on the std.  is_member_object_pointer inherited from std::integral_constant
  * @version 0.3 2022-11-15 Addition of remove_extent
- * @date 2022-11-15
+ * @version 0.4 2026-10-17 Addition of is_integral, is_trivially_copyable and is_trivially_destructible
+ * @version 0.5 2026-10-17 Addition of move and forward (not type traits but they need remove_reference and have no better place)
+ * @version 0.6 2026-10-17 Addition of iterator category tags and iterator_traits (only the category)
+ * @date 2026-10-17
  *
  * @copyright Copyright (c) 2022
  *
@@ -22,7 +25,8 @@
  *
  * I also avoided the types that would depend too much on compiler specific's or
  * require compiler build-in's. I just want something small, portable, and most of
- * all, useable.
+ * all, useable. The exception are is_trivially_copyable and is_trivially_destructible,
+ * these can't be done without the compiler, but GCC, Clang and MSVC all have them.
  *
  * Why:
  * This 're-implementation' was added because I also wanted to use this library
@@ -112,6 +116,33 @@ namespace libEmbedded
 
     template<typename T> struct is_member_object_pointer : integral_constant<bool, is_member_pointer<T>::value && !is_member_function_pointer<T>::value> {};
 
+    template<typename T> struct is_integral_helper : false_type {};
+    template<> struct is_integral_helper<bool> : true_type {};
+    template<> struct is_integral_helper<char> : true_type {};
+    template<> struct is_integral_helper<signed char> : true_type {};
+    template<> struct is_integral_helper<unsigned char> : true_type {};
+    template<> struct is_integral_helper<wchar_t> : true_type {};
+    template<> struct is_integral_helper<char16_t> : true_type {};
+    template<> struct is_integral_helper<char32_t> : true_type {};
+    template<> struct is_integral_helper<short> : true_type {};
+    template<> struct is_integral_helper<unsigned short> : true_type {};
+    template<> struct is_integral_helper<int> : true_type {};
+    template<> struct is_integral_helper<unsigned int> : true_type {};
+    template<> struct is_integral_helper<long> : true_type {};
+    template<> struct is_integral_helper<unsigned long> : true_type {};
+    template<> struct is_integral_helper<long long> : true_type {};
+    template<> struct is_integral_helper<unsigned long long> : true_type {};
+    template<typename T> struct is_integral : is_integral_helper<typename remove_cv<T>::type> {};
+
+    // Supported operations
+    template<typename T> struct is_trivially_copyable : integral_constant<bool, __is_trivially_copyable(T)> {};
+
+#if defined(__clang__) || defined(_MSC_VER)
+    template<typename T> struct is_trivially_destructible : integral_constant<bool, __is_trivially_destructible(T)> {};
+#else
+    template<typename T> struct is_trivially_destructible : integral_constant<bool, __has_trivial_destructor(T)> {};
+#endif
+
     // Property queries
     template< typename T > struct alignment_of : integral_constant<size_t, alignof(T)> {};
 
@@ -159,6 +190,29 @@ namespace libEmbedded
     template<bool B, typename T, typename F> struct conditional { using type = T; };
     template<typename T, typename F> struct conditional<false, T, F> { using type = F; };
 
+    // Iterators (from <iterator>), own tags so nothing depends on the STL. Iterators with a other iterator_category
+    // (like the STL ones) are treated as forward iterators, raw pointers are random access.
+    struct forward_iterator_tag {};
+    struct bidirectional_iterator_tag : forward_iterator_tag {};
+    struct random_access_iterator_tag : bidirectional_iterator_tag {};
+
+    template<typename T> struct make_void { typedef void type; };
+
+    template<typename T> struct iterator_category_helper
+    {
+        typedef typename conditional<is_same<T, random_access_iterator_tag>::value || is_same<T, bidirectional_iterator_tag>::value, T, forward_iterator_tag>::type type;
+    };
+
+    template<typename TIter, typename = void> struct iterator_traits { typedef forward_iterator_tag iterator_category; };
+    template<typename TIter> struct iterator_traits<TIter, typename make_void<typename TIter::iterator_category>::type> { typedef typename iterator_category_helper<typename TIter::iterator_category>::type iterator_category; };
+    template<typename T> struct iterator_traits<T*, void> { typedef random_access_iterator_tag iterator_category; };
+
+    // Utilities (from <utility>), always call these qualified so they never clash with std::move/std::forward through ADL.
+    template<typename T> constexpr typename remove_reference<T>::type&& move(T&& t) noexcept { return static_cast<typename remove_reference<T>::type&&>(t); }
+
+    template<typename T> constexpr T&& forward(typename remove_reference<T>::type& t) noexcept { return static_cast<T&&>(t); }
+    template<typename T> constexpr T&& forward(typename remove_reference<T>::type&& t) noexcept { return static_cast<T&&>(t); }
+
 } // namespace libEmbedded
 
 #endif // LIBEMBEDDED_TYPE_TRAIT_H
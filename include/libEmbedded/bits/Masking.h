@@ -5,7 +5,8 @@
  * @version 0.1 2022-10-28 Extract from original bits/helper.h file.
  * @version 0.2 2022-10-30 CreateMask is now a single statement function as well (+some weird behaviour, implementation defined??, on GCC with bit rolls on uint32_t's<<32 fixed in the process)
  * @version 0.3 2022-10-30 Added usage examples
- * @date 2022-10-30
+ * @version 0.4 2026-10-17 CreateMask specialization for uint64_t (a full 64 bit mask, and no recursion at runtime)
+ * @date 2026-10-17
  *
  * @copyright Copyright (c) 2022
  *
@@ -81,6 +82,12 @@ namespace libEmbedded
             return (((uint_least64_t)1 << bitLength) - 1) << startAtBit;
         }
 
+        template<>
+        constexpr uint64_t CreateMask(size_t bitLength, size_t startAtBit)
+        {
+            return startAtBit >= 64 ? 0 : (bitLength >= 64 ? ~(uint64_t)0 : (((uint64_t)1 << bitLength) - 1)) << startAtBit;
+        }
+
         template<>
         constexpr int8_t CreateMask(size_t bitLength, size_t startAtBit)
         {
@@ -4,7 +4,8 @@
  * @brief Some helper bit functions that don't really fit in one of the other categories and don't have their own.
  * @version 0.1 2022-10-28 Extract from original bits/helper.h file.
  * @version 0.2 2022-10-30 Added usage examples
- * @date 2022-10-30
+ * @version 0.3 2026-10-17 Added CountLeadingZeros and CountTrailingZeros
+ * @date 2026-10-17
  *
  * @copyright Copyright (c) 2022
  *
@@ -14,6 +15,7 @@
 #define LIBEMBEDDED_BITS_UTIL_H
 #include <stddef.h>
 #include <limits.h>
+#include <stdint.h>
 
 namespace libEmbedded
 {
@@ -38,6 +40,62 @@ namespace libEmbedded
         {
             return sizeof(T) * CHAR_BIT;
         }
+
+        /**
+         * @brief Count the number of 0 bits above the highest 1 bit.
+         *
+         * Usage:
+         * @code
+         * size_t a = CountLeadingZeros(0x00F0000000000000);
+         * size_t b = CountLeadingZeros(0);
+         * // a == 8
+         * // b == 64
+         * @endcode
+         *
+         * @param value The value to count the bits in.
+         * @return size_t The number of leading 0 bits, 64 for 0.
+         */
+        inline size_t CountLeadingZeros(uint64_t value)
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            return value == 0 ? 64 : static_cast<size_t>(__builtin_clzll(value));
+#else
+            size_t count = 0;
+            for (uint64_t bit = (uint64_t)1 << 63; bit != 0 && (value & bit) == 0; bit >>= 1)
+            {
+                count++;
+            }
+            return count;
+#endif
+        }
+
+        /**
+         * @brief Count the number of 0 bits below the lowest 1 bit.
+         *
+         * Usage:
+         * @code
+         * size_t a = CountTrailingZeros(0xF0);
+         * size_t b = CountTrailingZeros(0);
+         * // a == 4
+         * // b == 64
+         * @endcode
+         *
+         * @param value The value to count the bits in.
+         * @return size_t The number of trailing 0 bits, 64 for 0.
+         */
+        inline size_t CountTrailingZeros(uint64_t value)
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            return value == 0 ? 64 : static_cast<size_t>(__builtin_ctzll(value));
+#else
+            size_t count = 0;
+            for (uint64_t bit = 1; bit != 0 && (value & bit) == 0; bit <<= 1)
+            {
+                count++;
+            }
+            return count;
+#endif
+        }
     } // namespace bits
 } // namespace libEmbedded
 
@@ -0,0 +1,190 @@
+#include <gtest/gtest.h>
+#include "libEmbedded/BipBuffer.h"
+#include <stdint.h>
+#include <string>
+
+using libEmbedded::BipBuffer;
+using libEmbedded::OverflowPolicy;
+using libEmbedded::Span;
+
+template <typename TBuffer>
+static bool AddString(TBuffer &buffer, const std::string &text)
+{
+    return buffer.Add(reinterpret_cast<const uint8_t *>(text.data()), text.size());
+}
+
+template <typename TBuffer>
+static std::string PopString(TBuffer &buffer)
+{
+    Span<const uint8_t> record = buffer.Peek();
+    std::string text(record.begin(), record.end());
+    buffer.Consume();
+    return text;
+}
+
+TEST(BipBuffer, EmptyBuffer)
+{
+    BipBuffer<32> buffer;
+    EXPECT_EQ(0, buffer.Count());
+    EXPECT_EQ(0, buffer.BytesUsed());
+    EXPECT_EQ(32, buffer.Capacity());
+    EXPECT_EQ(nullptr, buffer.Peek().begin());
+    buffer.Consume();
+    EXPECT_EQ(0, buffer.Count());
+}
+
+TEST(BipBuffer, RecordsOfDifferentSizes)
+{
+    BipBuffer<32> buffer;
+    ASSERT_TRUE(AddString(buffer, "a"));
+    ASSERT_TRUE(AddString(buffer, "hello"));
+    ASSERT_TRUE(AddString(buffer, ""));
+    ASSERT_TRUE(AddString(buffer, "frame"));
+    EXPECT_EQ(4, buffer.Count());
+    EXPECT_EQ(4 * 2 + 1 + 5 + 0 + 5, buffer.BytesUsed());
+    EXPECT_EQ("a", PopString(buffer));
+    EXPECT_EQ("hello", PopString(buffer));
+    EXPECT_EQ("", PopString(buffer));
+    EXPECT_EQ("frame", PopString(buffer));
+    EXPECT_EQ(0, buffer.Count());
+}
+
+TEST(BipBuffer, ReserveFillInPlaceAndCommitLess)
+{
+    BipBuffer<32> buffer;
+    Span<uint8_t> record = buffer.Reserve(10);
+    ASSERT_NE(nullptr, record.begin());
+    ASSERT_EQ(10, record.end() - record.begin());
+    record[0] = 0xAB;
+    record[1] = 0xCD;
+    // Not visible until committed.
+    EXPECT_EQ(0, buffer.Count());
+    buffer.Commit(2);
+    ASSERT_EQ(1, buffer.Count());
+    Span<const uint8_t> read = buffer.Peek();
+    ASSERT_EQ(2, read.end() - read.begin());
+    EXPECT_EQ(0xAB, read[0]);
+    EXPECT_EQ(0xCD, read[1]);
+    EXPECT_EQ(4, buffer.BytesUsed());
+}
+
+TEST(BipBuffer, RecordNeverStraddlesTheWrapPoint)
+{
+    BipBuffer<20> buffer;
+    ASSERT_TRUE(AddString(buffer, "0123456"));
+    ASSERT_TRUE(AddString(buffer, "abcdef"));
+    // 17 bytes used, only 3 left at the end and nothing consumed yet.
+    EXPECT_FALSE(AddString(buffer, "xy"));
+    EXPECT_EQ("0123456", PopString(buffer));
+    // The record goes to the start of the storage, the 3 bytes at the end are skipped.
+    ASSERT_TRUE(AddString(buffer, "wxyz"));
+    Span<uint8_t> record = buffer.Reserve(2);
+    EXPECT_EQ(nullptr, record.begin());
+    EXPECT_EQ(6 + 2 + 6, buffer.BytesUsed());
+    EXPECT_EQ("abcdef", PopString(buffer));
+    EXPECT_EQ("wxyz", PopString(buffer));
+    EXPECT_EQ(0, buffer.BytesUsed());
+    // Empty again, so the full storage can be used.
+    std::string large(18, 'L');
+    ASSERT_TRUE(AddString(buffer, large));
+    EXPECT_EQ(large, PopString(buffer));
+}
+
+TEST(BipBuffer, TooLargeRecordsAreRejected)
+{
+    BipBuffer<300, uint8_t> buffer;
+    static_assert(BipBuffer<300, uint8_t>::kMaxRecordSize == 255, "A uint8_t header limits the record to 255 bytes.");
+    static_assert(BipBuffer<20>::kMaxRecordSize == 18, "The header takes 2 bytes of the storage.");
+    std::string record(256, 'x');
+    EXPECT_FALSE(AddString(buffer, record));
+    record.resize(255);
+    EXPECT_TRUE(AddString(buffer, record));
+    EXPECT_EQ(256, buffer.BytesUsed());
+}
+
+TEST(BipBuffer, CommitWithoutReservationDoesNothing)
+{
+    BipBuffer<16> buffer;
+    EXPECT_TRUE(AddString(buffer, "abcdef"));
+    EXPECT_EQ(nullptr, buffer.Reserve(10).begin());
+    buffer.Commit(0);
+    EXPECT_EQ(1, buffer.Count());
+    EXPECT_EQ(8, buffer.BytesUsed());
+
+    Span<uint8_t> record = buffer.Reserve(2);
+    ASSERT_NE(nullptr, record.begin());
+    record[0] = 'g';
+    record[1] = 'h';
+    buffer.Commit(2);
+    // A second Commit must not publish the same reservation again.
+    buffer.Commit(2);
+    EXPECT_EQ(2, buffer.Count());
+    EXPECT_EQ("abcdef", PopString(buffer));
+    EXPECT_EQ("gh", PopString(buffer));
+    EXPECT_EQ(0, buffer.Count());
+}
+
+TEST(BipBuffer, ZeroLengthReservationCanBeCommitted)
+{
+    BipBuffer<16> buffer;
+    EXPECT_NE(nullptr, buffer.Reserve(0).begin());
+    buffer.Commit(0);
+    EXPECT_EQ(1, buffer.Count());
+    EXPECT_EQ(0, libEmbedded::Distance(buffer.Peek()));
+    buffer.Clear();
+    buffer.Commit(0);
+    EXPECT_EQ(0, buffer.Count());
+    // A empty record may come from a empty container, with a null data pointer.
+    EXPECT_TRUE(buffer.Add(nullptr, 0));
+    EXPECT_EQ(1, buffer.Count());
+}
+
+TEST(BipBuffer, DropOldestMakesRoom)
+{
+    BipBuffer<20, uint16_t, OverflowPolicy::DROP_OLDEST> buffer;
+    ASSERT_TRUE(AddString(buffer, "0123"));
+    ASSERT_TRUE(AddString(buffer, "4567"));
+    ASSERT_TRUE(AddString(buffer, "89"));
+    // 16 bytes used, the oldest record has to go to make room at the start.
+    ASSERT_TRUE(AddString(buffer, "abcd"));
+    EXPECT_EQ(3, buffer.Count());
+    EXPECT_EQ("4567", PopString(buffer));
+    EXPECT_EQ("89", PopString(buffer));
+    EXPECT_EQ("abcd", PopString(buffer));
+}
+
+TEST(BipBuffer, ClearAndReuse)
+{
+    BipBuffer<16> buffer;
+    ASSERT_TRUE(AddString(buffer, "abc"));
+    buffer.Clear();
+    EXPECT_EQ(0, buffer.Count());
+    EXPECT_EQ(nullptr, buffer.Peek().begin());
+    ASSERT_TRUE(AddString(buffer, "def"));
+    EXPECT_EQ("def", PopString(buffer));
+}
+
+TEST(BipBuffer, ManyRecordsKeepOrder)
+{
+    BipBuffer<64> buffer;
+    size_t added = 0;
+    size_t popped = 0;
+    for (size_t round = 0; round < 500; round++)
+    {
+        const std::string record(round % 13, static_cast<char>('a' + round % 26));
+        if (AddString(buffer, record + std::to_string(added)))
+        {
+            added++;
+        }
+        if (round % 3 != 0)
+        {
+            while (buffer.Count() > 2)
+            {
+                const std::string text = PopString(buffer);
+                EXPECT_EQ(std::to_string(popped), text.substr(text.find_first_of("0123456789")));
+                popped++;
+            }
+        }
+    }
+    EXPECT_GT(popped, 300);
+}
@@ -45,3 +45,11 @@ TEST(BitMaskCreatorFixture, SetNrBits5)
     uint16_t mask = SetNrBits<uint16_t>(5);
     ASSERT_EQ(0b11111, mask);
 }
+
+TEST(BitMaskCreatorFixture, CreateMask64Bits)
+{
+    ASSERT_EQ(UINT64_MAX, CreateMask<uint64_t>(64));
+    ASSERT_EQ(0xFFFFFFFFFFFFFF00, CreateMask<uint64_t>(56, 8));
+    ASSERT_EQ(0x7F00000000000000, CreateMask<uint64_t>(7, 56));
+    ASSERT_EQ(0x00, CreateMask<uint64_t>(5, 64));
+}
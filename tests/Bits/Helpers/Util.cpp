@@ -23,3 +23,19 @@ TEST(GetBitSizeTester, GetSizeOfInt32)
     ASSERT_EQ(32, GetBitSize<int32_t>());
     ASSERT_EQ(32, GetBitSize<uint32_t>());
 }
+
+TEST(CountZerosTester, CountLeadingZeros)
+{
+    ASSERT_EQ(64, libEmbedded::bits::CountLeadingZeros(0));
+    ASSERT_EQ(63, libEmbedded::bits::CountLeadingZeros(1));
+    ASSERT_EQ(8, libEmbedded::bits::CountLeadingZeros(0x00F0000000000000));
+    ASSERT_EQ(0, libEmbedded::bits::CountLeadingZeros(UINT64_MAX));
+}
+
+TEST(CountZerosTester, CountTrailingZeros)
+{
+    ASSERT_EQ(64, libEmbedded::bits::CountTrailingZeros(0));
+    ASSERT_EQ(0, libEmbedded::bits::CountTrailingZeros(1));
+    ASSERT_EQ(4, libEmbedded::bits::CountTrailingZeros(0xF0));
+    ASSERT_EQ(63, libEmbedded::bits::CountTrailingZeros(0x8000000000000000));
+}
@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 #include "libEmbedded/Buffer.h"
+#include "libEmbedded/Pointer.h"
 
 constexpr size_t kBufferSize = 5;
 using libEmbedded::Buffer;
@@ -73,3 +74,96 @@ TEST_F(BufferAssignmentAndConstructor, CopyConstructorFromDifferentSizeAndThenMo
     ASSERT_EQ(kValue1, bufferB[0]);
     ASSERT_EQ(kValue3, bufferB[1]);
 }
+
+namespace
+{
+    struct Counted
+    {
+        static int copies;
+        static int destructions;
+        int value;
+
+        Counted(int value) : value(value) {}
+        Counted(const Counted &other) : value(other.value)
+        {
+            copies++;
+        }
+        ~Counted()
+        {
+            destructions++;
+        }
+    };
+    int Counted::copies = 0;
+    int Counted::destructions = 0;
+} // namespace
+
+TEST_F(BufferAssignmentAndConstructor, NonTrivialTypeCopiedAndDestroyedPerElement)
+{
+    {
+        Buffer<Counted, 3> bufferA;
+        for (int i = 0; i < 5; i++)
+        {
+            bufferA.Add(Counted(i));
+        }
+        Counted::copies = 0;
+        Counted::destructions = 0;
+        Buffer<Counted, 3> bufferB(bufferA);
+        EXPECT_EQ(3, Counted::copies);
+        EXPECT_EQ(2, bufferB[0].value);
+        EXPECT_EQ(4, bufferB[2].value);
+        bufferB.Remove(2);
+        EXPECT_EQ(2, Counted::destructions);
+        Counted::destructions = 0;
+    }
+    // 3 elements in bufferA and 1 left in bufferB.
+    EXPECT_EQ(4, Counted::destructions);
+}
+
+TEST_F(BufferAssignmentAndConstructor, AssignmentFromWrappedBuffer)
+{
+    BufferT bufferA;
+    BufferT bufferB;
+    for (T i = 0; i < kBufferSize + 2; i++)
+    {
+        bufferA.Add(i);
+    }
+    bufferB.Add(100);
+    bufferB = bufferA;
+    ASSERT_EQ(kBufferSize, bufferB.Size());
+    for (T i = 0; i < kBufferSize; i++)
+    {
+        EXPECT_EQ(i + 2, bufferB[i]);
+    }
+}
+
+TEST_F(BufferAssignmentAndConstructor, MoveConstructorEmptiesSource)
+{
+    using Element = libEmbedded::LocalPointer<int>;
+    Buffer<Element, 3> bufferA;
+    for (int i = 0; i < 4; i++)
+    {
+        bufferA.Emplace(new int(i));
+    }
+    Buffer<Element, 3> bufferB(libEmbedded::move(bufferA));
+    ASSERT_EQ(0, bufferA.Size());
+    ASSERT_EQ(3, bufferB.Size());
+    EXPECT_EQ(1, *bufferB[0]);
+    EXPECT_EQ(3, *bufferB[2]);
+}
+
+TEST_F(BufferAssignmentAndConstructor, MoveAssignmentReplacesContent)
+{
+    Buffer<Counted, 3> bufferA;
+    Buffer<Counted, 3> bufferB;
+    bufferA.Emplace(1);
+    bufferA.Emplace(2);
+    bufferB.Emplace(10);
+    Counted::destructions = 0;
+    bufferB = libEmbedded::move(bufferA);
+    // The old element of bufferB and the two moved-from elements of bufferA.
+    EXPECT_EQ(3, Counted::destructions);
+    ASSERT_EQ(0, bufferA.Size());
+    ASSERT_EQ(2, bufferB.Size());
+    EXPECT_EQ(1, bufferB[0].value);
+    EXPECT_EQ(2, bufferB[1].value);
+}
@@ -148,3 +148,29 @@ TYPED_TEST(BufferComparison, CompareInequalWithItSelf)
     this->bufferA.Add(11);
     ASSERT_FALSE(this->bufferA != this->bufferA);
 }
+
+TYPED_TEST(BufferComparison, CompareEqualWithEqualContentAtDifferentWrapPoints)
+{
+    typename TypeParam::BufferBType bufferB;
+    for (size_t i = 0; i < kBufferSize + 3; i++)
+    {
+        this->bufferA.Add(i);
+    }
+    for (size_t i = 3; i < kBufferSize + 3; i++)
+    {
+        bufferB.Add(i);
+    }
+    ASSERT_TRUE(this->bufferA == bufferB);
+    bufferB.Remove(1);
+    bufferB.Add(100);
+    ASSERT_TRUE(this->bufferA != bufferB);
+}
+
+TEST(BufferComparison, CompareFloatsByValueNotByBytes)
+{
+    Buffer<float, kBufferSize> bufferA;
+    Buffer<float, kBufferSize> bufferB;
+    bufferA.Add(0.0f);
+    bufferB.Add(-0.0f);
+    ASSERT_TRUE(bufferA == bufferB);
+}
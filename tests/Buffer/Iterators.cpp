@@ -1,5 +1,7 @@
 #include <gtest/gtest.h>
 #include "libEmbedded/Buffer.h"
+#include "libEmbedded/Iterator.h"
+#include "libEmbedded/Span.h"
 
 constexpr size_t kBufferSize = 5;
 using libEmbedded::Buffer;
@@ -127,3 +129,100 @@ TEST_F(BufferIterators, ModifyEnd)
     ASSERT_EQ(10, this->buffer.GetItem(3));
     ASSERT_EQ(5, this->buffer.GetItem(4));
 }
+
+TEST_F(BufferIterators, IterateOverWrapPoint)
+{
+    for (T i = 1; i <= 7; i++)
+    {
+        this->buffer.Add(i);
+    }
+    T expected = 3;
+    for (BufferT::const_iterator it = this->buffer.cbegin(); it != this->buffer.cend(); ++it)
+    {
+        EXPECT_EQ(expected, *it);
+        expected++;
+    }
+    ASSERT_EQ(8, expected);
+}
+
+TEST_F(BufferIterators, ModifyOverWrapPoint)
+{
+    for (T i = 1; i <= 7; i++)
+    {
+        this->buffer.Add(i);
+    }
+    BufferT::iterator it = this->buffer.begin();
+    it += 3;
+    *it = 10;
+    ASSERT_EQ(3, this->buffer.GetItem(0));
+    ASSERT_EQ(10, this->buffer.GetItem(3));
+    ASSERT_EQ(7, this->buffer.GetItem(4));
+}
+
+TEST_F(BufferIterators, RandomAccessOverWrapPoint)
+{
+    for (T i = 1; i <= 7; i++)
+    {
+        this->buffer.Add(i);
+    }
+    BufferT::const_iterator begin = this->buffer.cbegin();
+    BufferT::const_iterator end = this->buffer.cend();
+    ASSERT_EQ(5, end - begin);
+    ASSERT_EQ(-5, begin - end);
+    EXPECT_EQ(3, begin[0]);
+    EXPECT_EQ(6, begin[3]);
+    EXPECT_EQ(7, *(end - 1));
+    EXPECT_EQ(5, *(2 + begin));
+    EXPECT_EQ(5, (end - 2)[-1]);
+    EXPECT_TRUE(begin < end);
+    EXPECT_TRUE(end > begin);
+    EXPECT_TRUE(begin <= begin);
+    EXPECT_TRUE(end >= begin);
+    EXPECT_FALSE(end < begin);
+}
+
+TEST_F(BufferIterators, SegmentsOverWrapPoint)
+{
+    for (T i = 1; i <= 7; i++)
+    {
+        this->buffer.Add(i);
+    }
+    // Storage is {6, 7, 3, 4, 5} with the head at 2.
+    BufferT::iterator begin = this->buffer.begin();
+    EXPECT_EQ(3, begin.ContiguousLength());
+    libEmbedded::BufferSegments<T> segments = begin.SegmentsTo(this->buffer.end());
+    ASSERT_EQ(5, segments.Size());
+    ASSERT_EQ(3, segments.first.end() - segments.first.begin());
+    EXPECT_EQ(3, segments.first[0]);
+    EXPECT_EQ(5, segments.first[2]);
+    EXPECT_EQ(6, segments.second[0]);
+    EXPECT_EQ(7, segments.second[1]);
+
+    segments = (begin + 1).SegmentsTo(begin + 3);
+    EXPECT_EQ(2, segments.first.end() - segments.first.begin());
+    EXPECT_EQ(0, segments.second.end() - segments.second.begin());
+}
+
+TEST_F(BufferIterators, WorksWithIteratorHelpersAndSpan)
+{
+    for (T i = 1; i <= 7; i++)
+    {
+        this->buffer.Add(i);
+    }
+    EXPECT_EQ(5, libEmbedded::Distance(this->buffer));
+    EXPECT_EQ(6, *libEmbedded::Next(this->buffer.cbegin(), 3));
+    EXPECT_EQ(5, *libEmbedded::Prev(this->buffer.cend(), 3));
+
+    BufferT key;
+    key.Add(5);
+    key.Add(6);
+    BufferT::const_iterator foundAt = this->buffer.cbegin();
+    ASSERT_TRUE(libEmbedded::FindStartOf(this->buffer, key, foundAt));
+    EXPECT_EQ(2, foundAt - this->buffer.cbegin());
+
+    libEmbedded::Span<T, BufferT::iterator, BufferT::const_iterator> span(this->buffer.begin() + 1, 3);
+    EXPECT_EQ(4, span[0]);
+    EXPECT_EQ(6, span[2]);
+    span[2] = 60;
+    EXPECT_EQ(60, this->buffer[3]);
+}
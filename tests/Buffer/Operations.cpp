@@ -1,5 +1,8 @@
 #include <gtest/gtest.h>
 #include "libEmbedded/Buffer.h"
+#include "libEmbedded/Pointer.h"
+#include <iterator>
+#include <string>
 
 constexpr size_t kBufferSize = 5;
 
@@ -194,3 +197,178 @@ TEST(BufferOperations, RemoveRangeAndProperMemoryClear)
     buffer.Remove(1);
     EXPECT_EQ(4, buffer.Size());
 }
+
+TEST_F(BufferOperationsFixture, AddPastCapacityWrapsAndRemoveAfterwards)
+{
+    for (T i = 1; i <= 8; i++)
+    {
+        this->buffer.Add(i);
+    }
+    ASSERT_EQ(5, this->buffer.Size());
+    EXPECT_EQ(4, this->buffer.GetItem(0));
+    EXPECT_EQ(8, this->buffer.GetItem(4));
+    this->buffer.Remove(3);
+    ASSERT_EQ(2, this->buffer.Size());
+    EXPECT_EQ(7, this->buffer.GetItem(0));
+    EXPECT_EQ(8, this->buffer.GetItem(1));
+    this->buffer.Add(9);
+    this->buffer.Add(10);
+    this->buffer.Add(11);
+    this->buffer.Add(12);
+    ASSERT_EQ(5, this->buffer.Size());
+    EXPECT_EQ(8, this->buffer.GetItem(0));
+    EXPECT_EQ(9, this->buffer.GetItem(1));
+    EXPECT_EQ(10, this->buffer.GetItem(2));
+    EXPECT_EQ(11, this->buffer.GetItem(3));
+    EXPECT_EQ(12, this->buffer.GetItem(4));
+}
+
+TEST_F(BufferOperationsFixture, AddRangeOverWrapPoint)
+{
+    this->buffer.Add(1);
+    this->buffer.Add(2);
+    this->buffer.Add(3);
+    this->buffer.Remove(2);
+    T values[4] = {4, 5, 6, 7};
+    this->buffer.AddRange(values, sizeof(values) / sizeof(T));
+    ASSERT_EQ(5, this->buffer.Size());
+    EXPECT_EQ(3, this->buffer.GetItem(0));
+    EXPECT_EQ(4, this->buffer.GetItem(1));
+    EXPECT_EQ(5, this->buffer.GetItem(2));
+    EXPECT_EQ(6, this->buffer.GetItem(3));
+    EXPECT_EQ(7, this->buffer.GetItem(4));
+}
+
+namespace
+{
+    struct ConstructionCounter
+    {
+        static int constructions;
+        static int copies;
+        static int moves;
+        int a;
+        int b;
+
+        ConstructionCounter(int a, int b) : a(a), b(b)
+        {
+            constructions++;
+        }
+        ConstructionCounter(const ConstructionCounter &other) : a(other.a), b(other.b)
+        {
+            copies++;
+        }
+        ConstructionCounter(ConstructionCounter &&other) : a(other.a), b(other.b)
+        {
+            moves++;
+        }
+
+        static void Reset()
+        {
+            constructions = 0;
+            copies = 0;
+            moves = 0;
+        }
+    };
+    int ConstructionCounter::constructions = 0;
+    int ConstructionCounter::copies = 0;
+    int ConstructionCounter::moves = 0;
+} // namespace
+
+TEST(BufferOperations, EmplaceConstructsOnceInPlace)
+{
+    Buffer<ConstructionCounter, 2> buffer;
+    ConstructionCounter::Reset();
+    ConstructionCounter *added = buffer.Emplace(1, 2);
+    ASSERT_NE(nullptr, added);
+    EXPECT_EQ(1, added->a);
+    buffer.Emplace(3, 4);
+    buffer.Emplace(5, 6);
+    EXPECT_EQ(3, ConstructionCounter::constructions);
+    EXPECT_EQ(0, ConstructionCounter::copies);
+    EXPECT_EQ(0, ConstructionCounter::moves);
+    ASSERT_EQ(2, buffer.Size());
+    EXPECT_EQ(3, buffer[0].a);
+    EXPECT_EQ(6, buffer[1].b);
+}
+
+TEST(BufferOperations, AddRvalueMovesInsteadOfCopies)
+{
+    Buffer<ConstructionCounter, 2> buffer;
+    ConstructionCounter value(1, 2);
+    ConstructionCounter::Reset();
+    buffer.Add(libEmbedded::move(value));
+    buffer.Add(value);
+    EXPECT_EQ(1, ConstructionCounter::moves);
+    EXPECT_EQ(1, ConstructionCounter::copies);
+}
+
+TEST(BufferOperations, MoveOnlyElements)
+{
+    using Element = libEmbedded::LocalPointer<int>;
+    Buffer<Element, 2> buffer;
+    buffer.Emplace(new int(1));
+    buffer.Add(Element(new int(2)));
+    buffer.Emplace(new int(3));
+    ASSERT_EQ(2, buffer.Size());
+    EXPECT_EQ(2, *buffer[0]);
+    EXPECT_EQ(3, *buffer[1]);
+}
+
+TEST(BufferOperations, AddOldestElementToFullBuffer)
+{
+    // Long enough to live on the heap, a element that was destroyed before it is copied can't go unnoticed.
+    const std::string first(40, 'a');
+    const std::string second(40, 'b');
+    Buffer<std::string, 2> buffer;
+    buffer.Add(first);
+    buffer.Add(second);
+    // The new element takes the slot of the oldest one, which is the element that is added.
+    buffer.Add(buffer[0]);
+    ASSERT_EQ(2, buffer.Size());
+    EXPECT_EQ(second, buffer[0]);
+    EXPECT_EQ(first, buffer[1]);
+    buffer.Emplace(buffer[0]);
+    ASSERT_EQ(2, buffer.Size());
+    EXPECT_EQ(first, buffer[0]);
+    EXPECT_EQ(second, buffer[1]);
+}
+
+TEST(BufferOperations, AddRangeFromMoveIterators)
+{
+    Buffer<ConstructionCounter, 3> buffer;
+    ConstructionCounter values[4] = {{1, 1}, {2, 2}, {3, 3}, {4, 4}};
+    ConstructionCounter::Reset();
+    buffer.AddRange(std::make_move_iterator(values), std::make_move_iterator(values + 4));
+    EXPECT_EQ(4, ConstructionCounter::moves);
+    EXPECT_EQ(0, ConstructionCounter::copies);
+    ASSERT_EQ(3, buffer.Size());
+    EXPECT_EQ(2, buffer[0].a);
+    EXPECT_EQ(4, buffer[2].a);
+}
+
+TEST(BufferOperations, IndexWrapsWithMaskOrCompare)
+{
+    EXPECT_EQ(3, libEmbedded::BufferIndex<8>::Wrap(11));
+    EXPECT_EQ(7, libEmbedded::BufferIndex<8>::Wrap(7));
+    EXPECT_EQ(1, libEmbedded::BufferIndex<5>::Wrap(6));
+    EXPECT_EQ(4, libEmbedded::BufferIndex<5>::Wrap(4));
+    EXPECT_EQ(0, libEmbedded::BufferIndex<1>::Wrap(1));
+}
+
+TEST(BufferOperations, PowerOfTwoBufferOverWrapPoint)
+{
+    Buffer<uint8_t, 4> buffer;
+    for (uint8_t i = 1; i <= 10; i++)
+    {
+        buffer.Add(i);
+    }
+    ASSERT_EQ(4, buffer.Size());
+    uint8_t expected = 7;
+    for (uint8_t value : buffer)
+    {
+        EXPECT_EQ(expected++, value);
+    }
+    buffer.Remove(1);
+    EXPECT_EQ(8, buffer[0]);
+    EXPECT_EQ(10, buffer[2]);
+}
@@ -0,0 +1,91 @@
+#include <gtest/gtest.h>
+#include "libEmbedded/Buffer.h"
+#include <vector>
+
+constexpr size_t kBufferSize = 3;
+using libEmbedded::Buffer;
+using libEmbedded::BufferSegments;
+using libEmbedded::OverflowPolicy;
+using T = uint8_t;
+using DropBufferT = Buffer<T, kBufferSize>;
+using RejectBufferT = Buffer<T, kBufferSize, alignof(T), OverflowPolicy::REJECT>;
+
+TEST(BufferOverflowPolicy, DropOldestAddAlwaysSucceeds)
+{
+    DropBufferT buffer;
+    for (T i = 1; i <= 5; i++)
+    {
+        ASSERT_TRUE(buffer.Add(i));
+    }
+    ASSERT_EQ(3, buffer.Size());
+    EXPECT_EQ(3, buffer[0]);
+    EXPECT_EQ(5, buffer[2]);
+}
+
+TEST(BufferOverflowPolicy, RejectAddFailsWhenFull)
+{
+    RejectBufferT buffer;
+    for (T i = 1; i <= 3; i++)
+    {
+        ASSERT_TRUE(buffer.Add(i));
+    }
+    ASSERT_FALSE(buffer.Add(4));
+    ASSERT_EQ(nullptr, buffer.Emplace(static_cast<T>(5)));
+    ASSERT_EQ(3, buffer.Size());
+    EXPECT_EQ(1, buffer[0]);
+    EXPECT_EQ(3, buffer[2]);
+
+    buffer.Remove(1);
+    ASSERT_TRUE(buffer.Add(4));
+    EXPECT_EQ(2, buffer[0]);
+    EXPECT_EQ(4, buffer[2]);
+}
+
+TEST(BufferOverflowPolicy, DropOldestAddRangeKeepsLastElements)
+{
+    DropBufferT buffer;
+    buffer.Add(9);
+    const T elements[] = {1, 2, 3, 4};
+    ASSERT_EQ(3, buffer.AddRange(elements, 4));
+    ASSERT_EQ(3, buffer.Size());
+    EXPECT_EQ(2, buffer[0]);
+    EXPECT_EQ(4, buffer[2]);
+}
+
+TEST(BufferOverflowPolicy, RejectAddRangeKeepsFirstElements)
+{
+    RejectBufferT buffer;
+    buffer.Add(9);
+    const T elements[] = {1, 2, 3, 4};
+    ASSERT_EQ(2, buffer.AddRange(elements, 4));
+    ASSERT_EQ(3, buffer.Size());
+    EXPECT_EQ(9, buffer[0]);
+    EXPECT_EQ(1, buffer[1]);
+    EXPECT_EQ(2, buffer[2]);
+    ASSERT_EQ(0, buffer.AddRange(elements, 4));
+}
+
+TEST(BufferOverflowPolicy, RejectIteratorAddRangeStopsWhenFull)
+{
+    RejectBufferT buffer;
+    std::vector<T> elements = {1, 2, 3, 4, 5};
+    ASSERT_EQ(3, buffer.AddRange(elements.begin(), elements.end()));
+    ASSERT_EQ(3, buffer.Size());
+    EXPECT_EQ(1, buffer[0]);
+    EXPECT_EQ(3, buffer[2]);
+}
+
+TEST(BufferOverflowPolicy, RejectReserveOnlyHandsOutFreeSlots)
+{
+    RejectBufferT buffer;
+    buffer.Add(1);
+    buffer.Add(2);
+    BufferSegments<T> slots = buffer.Reserve(3);
+    ASSERT_EQ(1, slots.Size());
+    slots.first[0] = 3;
+    buffer.Commit(3);
+    ASSERT_EQ(3, buffer.Size());
+    EXPECT_EQ(1, buffer[0]);
+    EXPECT_EQ(3, buffer[2]);
+    ASSERT_EQ(0, buffer.Reserve(1).Size());
+}
@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 #include "libEmbedded/Buffer.h"
+#include "libEmbedded/Helpers.h"
 
 constexpr size_t kBufferSize = 5;
 using libEmbedded::Buffer;
@@ -148,3 +149,26 @@ TEST_F(BufferRetrieval, IndexOperatorOnConstBufferAndThenChange)
     ASSERT_EQ(kValue2, this->buffer[1]);
     ASSERT_EQ(kValue3, val);
 }
+
+TEST(BufferAlignment, StorageAlignedForElementType)
+{
+    struct
+    {
+        char pad;
+        Buffer<double, 3> buffer;
+    } holder;
+    holder.buffer.Add(1.0);
+    EXPECT_EQ(0, reinterpret_cast<uintptr_t>(&holder.buffer[0]) % alignof(double));
+}
+
+TEST(BufferAlignment, StorageAlignedToRequestedAlignment)
+{
+    struct
+    {
+        char pad;
+        Buffer<float, 16, libEmbedded::kCacheLineSize> buffer;
+    } holder;
+    holder.buffer.Add(1.0f);
+    EXPECT_EQ(0, reinterpret_cast<uintptr_t>(&holder.buffer[0]) % libEmbedded::kCacheLineSize);
+    EXPECT_EQ(0, reinterpret_cast<uintptr_t>(holder.buffer.Peek().first.begin()) % libEmbedded::kCacheLineSize);
+}
@@ -0,0 +1,171 @@
+#include <gtest/gtest.h>
+#include "libEmbedded/Buffer.h"
+#include "libEmbedded/AtomicBufferStats.h"
+#include <atomic>
+#include <thread>
+
+constexpr size_t kBufferSize = 4;
+using libEmbedded::AtomicBufferStats;
+using libEmbedded::Buffer;
+using libEmbedded::BufferSegments;
+using libEmbedded::BufferStats;
+using libEmbedded::BufferStatsSnapshot;
+using libEmbedded::OverflowPolicy;
+using T = uint32_t;
+using DropBufferT = Buffer<T, kBufferSize, alignof(T), OverflowPolicy::DROP_OLDEST, BufferStats>;
+using RejectBufferT = Buffer<T, kBufferSize, alignof(T), OverflowPolicy::REJECT, BufferStats>;
+
+TEST(BufferStats, NoStatsAddsNoSize)
+{
+    struct Layout
+    {
+        T elements[kBufferSize];
+        size_t head;
+        size_t elementsUsed;
+    };
+    ASSERT_EQ(sizeof(Layout), sizeof(Buffer<T, kBufferSize>));
+}
+
+TEST(BufferStats, CountsAddsAndPeak)
+{
+    DropBufferT buffer;
+    buffer.Add(1);
+    buffer.Emplace(2u);
+    const T elements[] = {3, 4};
+    buffer.AddRange(elements, 2);
+    buffer.Remove(3);
+    buffer.Add(5);
+
+    BufferStatsSnapshot stats = buffer.GetStats().Snapshot();
+    EXPECT_EQ(5, stats.adds);
+    EXPECT_EQ(0, stats.drops);
+    EXPECT_EQ(0, stats.overflows);
+    EXPECT_EQ(3, stats.removes);
+    EXPECT_EQ(4, stats.peakSize);
+}
+
+TEST(BufferStats, DropOldestCountsDroppedElements)
+{
+    DropBufferT buffer;
+    for (T i = 0; i < 6; i++)
+    {
+        buffer.Add(i);
+    }
+    // One more than fits, so the first element of the range is dropped too.
+    const T elements[] = {6, 7, 8, 9, 10};
+    buffer.AddRange(elements, 5);
+
+    BufferStatsSnapshot stats = buffer.GetStats().Snapshot();
+    EXPECT_EQ(10, stats.adds);
+    EXPECT_EQ(7, stats.drops);
+    EXPECT_EQ(3, stats.overflows);
+    EXPECT_EQ(0, stats.removes);
+    EXPECT_EQ(4, stats.peakSize);
+}
+
+TEST(BufferStats, RejectCountsRejectedElements)
+{
+    RejectBufferT buffer;
+    const T elements[] = {1, 2, 3, 4, 5, 6};
+    buffer.AddRange(elements, 6);
+    buffer.Add(7);
+
+    BufferStatsSnapshot stats = buffer.GetStats().Snapshot();
+    EXPECT_EQ(4, stats.adds);
+    EXPECT_EQ(3, stats.drops);
+    EXPECT_EQ(2, stats.overflows);
+}
+
+TEST(BufferStats, ZeroCopyIsCounted)
+{
+    DropBufferT buffer;
+    buffer.Add(1);
+    buffer.Add(2);
+    BufferSegments<T> slots = buffer.Reserve(3);
+    ASSERT_EQ(3, slots.Size());
+    buffer.Commit(3);
+    buffer.Consume(2);
+
+    BufferStatsSnapshot stats = buffer.GetStats().Snapshot();
+    EXPECT_EQ(5, stats.adds);
+    EXPECT_EQ(1, stats.drops);
+    EXPECT_EQ(1, stats.overflows);
+    EXPECT_EQ(2, stats.removes);
+    EXPECT_EQ(4, stats.peakSize);
+}
+
+TEST(BufferStats, ResetStartsFromZero)
+{
+    DropBufferT buffer;
+    for (T i = 0; i < 5; i++)
+    {
+        buffer.Add(i);
+    }
+    buffer.GetStats().Reset();
+    buffer.Remove(2);
+    buffer.Add(9);
+
+    BufferStatsSnapshot stats = buffer.GetStats().Snapshot();
+    EXPECT_EQ(1, stats.adds);
+    EXPECT_EQ(0, stats.drops);
+    EXPECT_EQ(2, stats.removes);
+    EXPECT_EQ(3, stats.peakSize);
+}
+
+TEST(BufferStats, CopyStartsWithFreshStats)
+{
+    DropBufferT buffer;
+    buffer.Add(1);
+    DropBufferT copy(buffer);
+    EXPECT_EQ(0, copy.GetStats().Snapshot().adds);
+    EXPECT_EQ(1, buffer.GetStats().Snapshot().adds);
+}
+
+TEST(BufferStats, AtomicStatsResetKeepsCounting)
+{
+    Buffer<T, kBufferSize, alignof(T), OverflowPolicy::DROP_OLDEST, AtomicBufferStats> buffer;
+    for (T i = 0; i < 6; i++)
+    {
+        buffer.Add(i);
+    }
+    BufferStatsSnapshot stats = buffer.GetStats().Snapshot();
+    EXPECT_EQ(6, stats.adds);
+    EXPECT_EQ(2, stats.drops);
+    EXPECT_EQ(4, stats.peakSize);
+
+    buffer.GetStats().Reset();
+    buffer.Add(6);
+    stats = buffer.GetStats().Snapshot();
+    EXPECT_EQ(1, stats.adds);
+    EXPECT_EQ(1, stats.drops);
+    EXPECT_EQ(1, stats.overflows);
+    EXPECT_EQ(4, stats.peakSize);
+}
+
+TEST(BufferStats, AtomicStatsReadFromMonitorThread)
+{
+    constexpr size_t kAdds = 100000;
+    Buffer<T, kBufferSize, alignof(T), OverflowPolicy::DROP_OLDEST, AtomicBufferStats> buffer;
+    const AtomicBufferStats &stats = buffer.GetStats();
+    std::atomic<bool> done(false);
+    std::thread monitor([&stats, &done]() {
+        size_t lastAdds = 0;
+        while (!done.load())
+        {
+            const size_t adds = stats.Snapshot().adds;
+            // The owner is the only writer, the counter can only go up.
+            EXPECT_GE(adds, lastAdds);
+            lastAdds = adds;
+            std::this_thread::yield();
+        }
+    });
+    for (size_t i = 0; i < kAdds; i++)
+    {
+        buffer.Add(static_cast<T>(i));
+    }
+    done.store(true);
+    monitor.join();
+    BufferStatsSnapshot snapshot = buffer.GetStats().Snapshot();
+    EXPECT_EQ(kAdds, snapshot.adds);
+    EXPECT_EQ(kAdds - kBufferSize, snapshot.drops);
+}
@@ -0,0 +1,87 @@
+#include <gtest/gtest.h>
+#include "libEmbedded/Buffer.h"
+
+constexpr size_t kBufferSize = 5;
+using libEmbedded::Buffer;
+using libEmbedded::BufferSegments;
+using T = uint8_t;
+using BufferT = Buffer<T, kBufferSize>;
+
+class BufferZeroCopy : public ::testing::Test
+{
+protected:
+    BufferT buffer;
+};
+
+TEST_F(BufferZeroCopy, ReserveInEmptyBufferIsOneSegment)
+{
+    BufferSegments<T> slots = this->buffer.Reserve(3);
+    ASSERT_EQ(3, slots.Size());
+    ASSERT_EQ(slots.first.begin() + 3, slots.first.end());
+    ASSERT_EQ(slots.second.begin(), slots.second.end());
+    slots.first[0] = 1;
+    slots.first[1] = 2;
+    slots.first[2] = 3;
+    ASSERT_EQ(0, this->buffer.Size());
+    this->buffer.Commit(2);
+    ASSERT_EQ(2, this->buffer.Size());
+    EXPECT_EQ(1, this->buffer[0]);
+    EXPECT_EQ(2, this->buffer[1]);
+}
+
+TEST_F(BufferZeroCopy, ReserveOverWrapPointIsTwoSegments)
+{
+    T values[4] = {1, 2, 3, 4};
+    this->buffer.AddRange(values, 4);
+    this->buffer.Remove(3);
+    BufferSegments<T> slots = this->buffer.Reserve(3);
+    ASSERT_EQ(3, slots.Size());
+    ASSERT_EQ(slots.first.begin() + 1, slots.first.end());
+    ASSERT_EQ(slots.second.begin() + 2, slots.second.end());
+    slots.first[0] = 5;
+    slots.second[0] = 6;
+    slots.second[1] = 7;
+    this->buffer.Commit(3);
+    ASSERT_EQ(4, this->buffer.Size());
+    EXPECT_EQ(4, this->buffer[0]);
+    EXPECT_EQ(5, this->buffer[1]);
+    EXPECT_EQ(6, this->buffer[2]);
+    EXPECT_EQ(7, this->buffer[3]);
+}
+
+TEST_F(BufferZeroCopy, ReserveMoreThanFreeDropsOldest)
+{
+    T values[4] = {1, 2, 3, 4};
+    this->buffer.AddRange(values, 4);
+    BufferSegments<T> slots = this->buffer.Reserve(3);
+    ASSERT_EQ(3, slots.Size());
+    ASSERT_EQ(2, this->buffer.Size());
+    EXPECT_EQ(3, this->buffer[0]);
+    this->buffer.Commit(10);
+    ASSERT_EQ(kBufferSize, this->buffer.Size());
+}
+
+TEST_F(BufferZeroCopy, PeekAndConsumeOverWrapPoint)
+{
+    for (T i = 1; i <= 7; i++)
+    {
+        this->buffer.Add(i);
+    }
+    BufferSegments<const T> elements = this->buffer.Peek();
+    ASSERT_EQ(kBufferSize, elements.Size());
+    ASSERT_EQ(elements.first.begin() + 3, elements.first.end());
+    EXPECT_EQ(3, elements.first[0]);
+    EXPECT_EQ(5, elements.first[2]);
+    EXPECT_EQ(6, elements.second[0]);
+    EXPECT_EQ(7, elements.second[1]);
+    this->buffer.Consume(4);
+    elements = this->buffer.Peek();
+    ASSERT_EQ(1, elements.Size());
+    EXPECT_EQ(7, elements.first[0]);
+}
+
+TEST_F(BufferZeroCopy, PeekEmptyBuffer)
+{
+    BufferSegments<const T> elements = this->buffer.Peek();
+    ASSERT_EQ(0, elements.Size());
+}
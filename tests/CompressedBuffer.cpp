@@ -0,0 +1,157 @@
+#include <gtest/gtest.h>
+#include "libEmbedded/CompressedBuffer.h"
+#include <stdint.h>
+#include <vector>
+
+using libEmbedded::CompressedBuffer;
+
+template <typename T, size_t TNumBlocks, size_t TBlockSize>
+static std::vector<T> DecodeAll(const CompressedBuffer<T, TNumBlocks, TBlockSize> &buffer)
+{
+    std::vector<T> values;
+    for (T value : buffer)
+    {
+        values.push_back(value);
+    }
+    return values;
+}
+
+TEST(CompressedBuffer, EmptyBuffer)
+{
+    CompressedBuffer<int32_t, 4, 16> buffer;
+    EXPECT_EQ(0, buffer.Size());
+    EXPECT_EQ(0, buffer.BlockCount());
+    EXPECT_EQ(0, buffer.BytesUsed());
+    EXPECT_TRUE(buffer.begin() == buffer.end());
+}
+
+TEST(CompressedBuffer, SmallDeltasTakeOneByte)
+{
+    CompressedBuffer<int32_t, 4, 16> buffer;
+    const std::vector<int32_t> values = {1000, 1001, 999, 1030, 1000, 937};
+    for (int32_t value : values)
+    {
+        buffer.Add(value);
+    }
+    // 1000 is stored as is (2 bytes), all differences are within -64..63 (1 byte).
+    EXPECT_EQ(7, buffer.BytesUsed());
+    EXPECT_EQ(1, buffer.BlockCount());
+    EXPECT_EQ(values.size(), buffer.Size());
+    EXPECT_EQ(937, buffer.Back());
+    EXPECT_EQ(values, DecodeAll(buffer));
+}
+
+TEST(CompressedBuffer, ExtremeValuesRoundTrip)
+{
+    CompressedBuffer<int32_t, 8, 16> buffer;
+    static_assert(CompressedBuffer<int32_t, 8, 16>::kMaxEncodedSize == 5, "A int32_t difference takes at most 5 bytes.");
+    const std::vector<int32_t> values = {INT32_MIN, INT32_MAX, INT32_MIN, 0, -1, INT32_MAX, INT32_MAX};
+    for (int32_t value : values)
+    {
+        buffer.Add(value);
+    }
+    EXPECT_EQ(values, DecodeAll(buffer));
+}
+
+TEST(CompressedBuffer, OtherTypesRoundTrip)
+{
+    CompressedBuffer<uint64_t, 4, 32> buffer64;
+    const std::vector<uint64_t> values64 = {0, UINT64_MAX, 1, UINT64_MAX - 1, 0x8000000000000000ull};
+    for (uint64_t value : values64)
+    {
+        buffer64.Add(value);
+    }
+    EXPECT_EQ(values64, DecodeAll(buffer64));
+
+    CompressedBuffer<uint8_t, 2, 4> buffer8;
+    const std::vector<uint8_t> values8 = {0, 255, 128, 127};
+    for (uint8_t value : values8)
+    {
+        buffer8.Add(value);
+    }
+    EXPECT_EQ(values8, DecodeAll(buffer8));
+}
+
+TEST(CompressedBuffer, FullBlockStartsANewBlock)
+{
+    CompressedBuffer<int32_t, 4, 5> buffer;
+    for (int32_t i = 0; i < 6; i++)
+    {
+        buffer.Add(i);
+    }
+    // 5 samples of 1 byte fill the first block, the sixth starts the second block.
+    EXPECT_EQ(2, buffer.BlockCount());
+    EXPECT_EQ(6, buffer.BytesUsed());
+    EXPECT_EQ((std::vector<int32_t>{0, 1, 2, 3, 4, 5}), DecodeAll(buffer));
+}
+
+TEST(CompressedBuffer, SampleThatDoesNotFitStartsANewBlock)
+{
+    CompressedBuffer<int32_t, 4, 5> buffer;
+    buffer.Add(0);
+    buffer.Add(1);
+    buffer.Add(2);
+    buffer.Add(100000);
+    // The 3 byte difference does not fit in the 2 bytes left.
+    EXPECT_EQ(2, buffer.BlockCount());
+    EXPECT_EQ((std::vector<int32_t>{0, 1, 2, 100000}), DecodeAll(buffer));
+}
+
+TEST(CompressedBuffer, DropsOldestBlockWhenFull)
+{
+    CompressedBuffer<int32_t, 3, 5> buffer;
+    for (int32_t i = 0; i < 16; i++)
+    {
+        buffer.Add(i);
+    }
+    // Blocks of 5 samples, the first block (0..4) made room for 15.
+    EXPECT_EQ(3, buffer.BlockCount());
+    EXPECT_EQ(11, buffer.Size());
+    std::vector<int32_t> expected;
+    for (int32_t i = 5; i < 16; i++)
+    {
+        expected.push_back(i);
+    }
+    EXPECT_EQ(expected, DecodeAll(buffer));
+}
+
+TEST(CompressedBuffer, RemoveBlockAndClear)
+{
+    CompressedBuffer<int32_t, 4, 5> buffer;
+    EXPECT_EQ(0, buffer.RemoveBlock());
+    for (int32_t i = 0; i < 7; i++)
+    {
+        buffer.Add(i * 2);
+    }
+    EXPECT_EQ(5, buffer.RemoveBlock());
+    EXPECT_EQ(2, buffer.Size());
+    EXPECT_EQ((std::vector<int32_t>{10, 12}), DecodeAll(buffer));
+    EXPECT_EQ(2, buffer.RemoveBlock());
+    EXPECT_EQ(0, buffer.Size());
+    EXPECT_EQ(0, buffer.BytesUsed());
+
+    buffer.Add(-5);
+    buffer.Clear();
+    EXPECT_EQ(0, buffer.Size());
+    EXPECT_TRUE(buffer.begin() == buffer.end());
+    buffer.Add(7);
+    EXPECT_EQ((std::vector<int32_t>{7}), DecodeAll(buffer));
+}
+
+TEST(CompressedBuffer, SlowSignalFitsMoreThanABuffer)
+{
+    constexpr size_t kBytes = 1024;
+    CompressedBuffer<int32_t, 16, kBytes / 16> buffer;
+    std::vector<int32_t> added;
+    int32_t value = 20000;
+    for (int32_t i = 0; i < 4000; i++)
+    {
+        // A slow random walk.
+        value += (i * 7919) % 11 - 5;
+        buffer.Add(value);
+        added.push_back(value);
+    }
+    EXPECT_GT(buffer.Size(), 3 * kBytes / sizeof(int32_t));
+    const std::vector<int32_t> expected(added.end() - buffer.Size(), added.end());
+    EXPECT_EQ(expected, DecodeAll(buffer));
+}
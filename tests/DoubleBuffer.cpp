@@ -0,0 +1,22 @@
+#include <gtest/gtest.h>
+#include "libEmbedded/DoubleBuffer.h"
+
+using libEmbedded::DoubleBuffer;
+
+TEST(DoubleBuffer, SwapMakesBackTheFront)
+{
+    DoubleBuffer<int> buffer;
+    EXPECT_EQ(0, buffer.Front());
+    buffer.Back() = 5;
+    EXPECT_EQ(0, buffer.Front());
+    buffer.Swap();
+    EXPECT_EQ(5, buffer.Front());
+    EXPECT_NE(&buffer.Back(), &buffer.Front());
+
+    // The new back slot holds the value from before the swap.
+    EXPECT_EQ(0, buffer.Back());
+    buffer.Back() = 6;
+    buffer.Swap();
+    EXPECT_EQ(6, buffer.Front());
+    EXPECT_EQ(5, buffer.Back());
+}
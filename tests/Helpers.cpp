@@ -169,3 +169,19 @@ INSTANTIATE_TEST_SUITE_P(
     ::testing::Values(
         5, 10, 15, 25, 30
 ));
+
+TEST(IsPowerOfTwoHelper, PowersOfTwo)
+{
+    EXPECT_TRUE(libEmbedded::IsPowerOfTwo(1));
+    EXPECT_TRUE(libEmbedded::IsPowerOfTwo(2));
+    EXPECT_TRUE(libEmbedded::IsPowerOfTwo(256));
+    EXPECT_TRUE(libEmbedded::IsPowerOfTwo(static_cast<size_t>(1) << (sizeof(size_t) * 8 - 1)));
+}
+
+TEST(IsPowerOfTwoHelper, NotPowersOfTwo)
+{
+    EXPECT_FALSE(libEmbedded::IsPowerOfTwo(0));
+    EXPECT_FALSE(libEmbedded::IsPowerOfTwo(3));
+    EXPECT_FALSE(libEmbedded::IsPowerOfTwo(1000));
+    EXPECT_FALSE(libEmbedded::IsPowerOfTwo(static_cast<size_t>(-1)));
+}
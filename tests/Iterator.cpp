@@ -279,3 +279,69 @@ TEST_F(FindIteratorFixture, FindKeyThatIsMultipleTimesInHaystack_ContainerHayKey
     ASSERT_TRUE(found);
     ASSERT_EQ(libEmbedded::Next(haystack.begin(), 3), foundAt);
 }
+
+// Random access iterator over a counter that counts how often it is stepped.
+struct CountingIterator
+{
+    typedef libEmbedded::random_access_iterator_tag iterator_category;
+    size_t position;
+    size_t *steps;
+
+    CountingIterator &operator++()
+    {
+        ++position;
+        ++*steps;
+        return *this;
+    }
+    CountingIterator &operator--()
+    {
+        --position;
+        ++*steps;
+        return *this;
+    }
+    CountingIterator &operator+=(size_t n)
+    {
+        position += n;
+        return *this;
+    }
+    CountingIterator operator+(size_t n) const
+    {
+        return CountingIterator{position + n, steps};
+    }
+    CountingIterator operator-(size_t n) const
+    {
+        return CountingIterator{position - n, steps};
+    }
+    ptrdiff_t operator-(const CountingIterator &other) const
+    {
+        return static_cast<ptrdiff_t>(position - other.position);
+    }
+    bool operator==(const CountingIterator &other) const
+    {
+        return position == other.position;
+    }
+};
+
+TEST(IteratorCategory, RandomAccessIteratorsAreNotStepped)
+{
+    size_t steps = 0;
+    CountingIterator begin{0, &steps};
+    CountingIterator end{100000, &steps};
+    EXPECT_EQ(100000, libEmbedded::Distance(begin, end));
+    EXPECT_EQ(70000, libEmbedded::Next(begin, 70000).position);
+    EXPECT_EQ(30000, libEmbedded::Prev(end, 70000).position);
+    libEmbedded::Advance(begin, 5000);
+    EXPECT_EQ(5000, begin.position);
+    EXPECT_EQ(0, steps);
+}
+
+static constexpr int kLargeArray[100000] = {};
+
+TEST(IteratorCategory, PointersAreConstantTime)
+{
+    // Would exceed the constexpr recursion depth when stepping.
+    static_assert(libEmbedded::Distance(kLargeArray, kLargeArray + 100000) == 100000, "Failed.");
+    static_assert(libEmbedded::Next(kLargeArray, 70000) == kLargeArray + 70000, "Failed.");
+    static_assert(libEmbedded::Prev(kLargeArray + 100000, 70000) == kLargeArray + 30000, "Failed.");
+    ASSERT_EQ(100000, libEmbedded::Distance(libEmbedded::Span<const int>(kLargeArray, 100000)));
+}
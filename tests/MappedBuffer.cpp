@@ -0,0 +1,255 @@
+#include <gtest/gtest.h>
+#include "libEmbedded/MappedBuffer.h"
+#include <stdint.h>
+#if defined(__unix__)
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+using libEmbedded::MappedBuffer;
+using libEmbedded::MappedBufferHeader;
+using libEmbedded::MappedBufferStatus;
+constexpr size_t kBufferSize = 4;
+using T = uint32_t;
+using BufferT = MappedBuffer<T, kBufferSize>;
+
+class MappedBufferFixture : public ::testing::Test
+{
+protected:
+    alignas(8) uint8_t region[BufferT::kRegionSize];
+
+    void SetUp() override
+    {
+        // Random garbage, just like a new file or uninitialized memory could contain.
+        for (size_t i = 0; i < sizeof(this->region); i++)
+        {
+            this->region[i] = static_cast<uint8_t>(i * 37 + 11);
+        }
+    }
+
+    MappedBufferHeader &Header()
+    {
+        return *reinterpret_cast<MappedBufferHeader *>(this->region);
+    }
+};
+
+TEST_F(MappedBufferFixture, AttachFormatsNewRegion)
+{
+    BufferT buffer;
+    ASSERT_FALSE(buffer.IsAttached());
+    ASSERT_EQ(MappedBufferStatus::FORMATTED, buffer.Attach(this->region, sizeof(this->region)));
+    ASSERT_TRUE(buffer.IsAttached());
+    ASSERT_EQ(0, buffer.Size());
+    ASSERT_EQ(kBufferSize, buffer.Capacity());
+    EXPECT_EQ(1, this->Header().version);
+    EXPECT_EQ(sizeof(T), this->Header().elementSize);
+    EXPECT_EQ(kBufferSize, this->Header().capacity);
+}
+
+TEST_F(MappedBufferFixture, RegionChecks)
+{
+    BufferT buffer;
+    ASSERT_EQ(MappedBufferStatus::TOO_SMALL, buffer.Attach(this->region, sizeof(this->region) - 1));
+    ASSERT_EQ(MappedBufferStatus::TOO_SMALL, buffer.Attach(nullptr, sizeof(this->region)));
+    ASSERT_EQ(MappedBufferStatus::MISALIGNED, buffer.Attach(this->region + 1, sizeof(this->region)));
+    ASSERT_FALSE(buffer.IsAttached());
+}
+
+TEST_F(MappedBufferFixture, AddDropsOldestOverWrapPoint)
+{
+    BufferT buffer;
+    buffer.Format(this->region, sizeof(this->region));
+    for (T i = 1; i <= 6; i++)
+    {
+        buffer.Add(i);
+    }
+    ASSERT_EQ(4, buffer.Size());
+    EXPECT_EQ(3, buffer[0]);
+    EXPECT_EQ(6, buffer[3]);
+    T expected = 3;
+    for (T value : buffer)
+    {
+        EXPECT_EQ(expected++, value);
+    }
+    const T elements[] = {7, 8, 9, 10, 11};
+    buffer.AddRange(elements, 5);
+    ASSERT_EQ(4, buffer.Size());
+    EXPECT_EQ(8, buffer[0]);
+    EXPECT_EQ(11, buffer[3]);
+    buffer.Remove(3);
+    ASSERT_EQ(1, buffer.Size());
+    EXPECT_EQ(11, buffer[0]);
+}
+
+TEST_F(MappedBufferFixture, ReattachRecoversElements)
+{
+    {
+        BufferT writer;
+        writer.Attach(this->region, sizeof(this->region));
+        for (T i = 1; i <= 5; i++)
+        {
+            writer.Add(i);
+        }
+        // No cleanup, just like a crash.
+    }
+    BufferT reader;
+    ASSERT_EQ(MappedBufferStatus::RECOVERED, reader.Attach(this->region, sizeof(this->region)));
+    ASSERT_EQ(4, reader.Size());
+    EXPECT_EQ(2, reader[0]);
+    EXPECT_EQ(5, reader[3]);
+}
+
+TEST_F(MappedBufferFixture, CrashWhileDroppingLeavesValidBuffer)
+{
+    BufferT buffer;
+    buffer.Format(this->region, sizeof(this->region));
+    for (T i = 1; i <= 4; i++)
+    {
+        buffer.Add(i);
+    }
+    // The state after a crash between dropping the oldest and publishing the new element.
+    this->Header().begin++;
+    BufferT recovered;
+    ASSERT_EQ(MappedBufferStatus::RECOVERED, recovered.Attach(this->region, sizeof(this->region)));
+    ASSERT_EQ(3, recovered.Size());
+    EXPECT_EQ(2, recovered[0]);
+}
+
+TEST(MappedBuffer, LargeFreeRunningIndicesWithOddCapacity)
+{
+    using OddBufferT = MappedBuffer<T, 5>;
+    alignas(8) uint8_t region[OddBufferT::kRegionSize];
+    OddBufferT buffer;
+    ASSERT_EQ(MappedBufferStatus::FORMATTED, buffer.Format(region, sizeof(region)));
+    // A long running log, the indices no longer fit in 32 bits and are not a multiple of the capacity.
+    MappedBufferHeader &header = *reinterpret_cast<MappedBufferHeader *>(region);
+    header.begin = 0x100000003ull;
+    header.end = 0x100000003ull;
+    OddBufferT attached;
+    ASSERT_EQ(MappedBufferStatus::RECOVERED, attached.Attach(region, sizeof(region)));
+    for (T i = 1; i <= 8; i++)
+    {
+        attached.Add(i);
+    }
+    attached.Remove(1);
+    ASSERT_EQ(4, attached.Size());
+    T expected = 5;
+    for (T value : attached)
+    {
+        EXPECT_EQ(expected++, value);
+    }
+    EXPECT_EQ(8, attached[3]);
+
+    OddBufferT reattached;
+    ASSERT_EQ(MappedBufferStatus::RECOVERED, reattached.Attach(region, sizeof(region)));
+    EXPECT_EQ(5, reattached[0]);
+    EXPECT_EQ(8, reattached[3]);
+}
+
+TEST(MappedBuffer, TwoViewsOnOneRegion)
+{
+    using OddBufferT = MappedBuffer<T, 5>;
+    alignas(8) uint8_t region[OddBufferT::kRegionSize];
+    OddBufferT first;
+    ASSERT_EQ(MappedBufferStatus::FORMATTED, first.Format(region, sizeof(region)));
+    first.Add(1);
+    OddBufferT second;
+    ASSERT_EQ(MappedBufferStatus::RECOVERED, second.Attach(region, sizeof(region)));
+    // The second view drops the oldest elements, the first one must not keep using its old head.
+    for (T i = 2; i <= 8; i++)
+    {
+        second.Add(i);
+    }
+    ASSERT_EQ(5, first.Size());
+    EXPECT_EQ(4, first[0]);
+    EXPECT_EQ(8, first[4]);
+    T expected = 4;
+    for (T value : first)
+    {
+        EXPECT_EQ(expected++, value);
+    }
+    // A add through the first view must not overwrite the elements the second view added.
+    const T elements[] = {9, 10};
+    first.AddRange(elements, 2);
+    EXPECT_EQ(6, second[0]);
+    EXPECT_EQ(10, second[4]);
+    // A copy is just another view as well.
+    OddBufferT copy = second;
+    copy.Remove(2);
+    ASSERT_EQ(3, second.Size());
+    EXPECT_EQ(8, second[0]);
+    EXPECT_EQ(8, first[0]);
+    EXPECT_EQ(10, first[2]);
+}
+
+TEST_F(MappedBufferFixture, ImpossibleHeaderIsRepaired)
+{
+    BufferT buffer;
+    buffer.Format(this->region, sizeof(this->region));
+    for (T i = 1; i <= 6; i++)
+    {
+        buffer.Add(i);
+    }
+    this->Header().begin = 0;
+    BufferT tooMany;
+    ASSERT_EQ(MappedBufferStatus::REPAIRED, tooMany.Attach(this->region, sizeof(this->region)));
+    ASSERT_EQ(4, tooMany.Size());
+    EXPECT_EQ(3, tooMany[0]);
+
+    this->Header().begin = this->Header().end + 1;
+    BufferT negative;
+    ASSERT_EQ(MappedBufferStatus::REPAIRED, negative.Attach(this->region, sizeof(this->region)));
+    ASSERT_EQ(0, negative.Size());
+}
+
+TEST_F(MappedBufferFixture, IncompatibleRegionIsLeftAlone)
+{
+    MappedBuffer<T, kBufferSize - 1> smaller;
+    smaller.Format(this->region, sizeof(this->region));
+    smaller.Add(42);
+
+    BufferT buffer;
+    ASSERT_EQ(MappedBufferStatus::INCOMPATIBLE, buffer.Attach(this->region, sizeof(this->region)));
+    ASSERT_FALSE(buffer.IsAttached());
+    ASSERT_EQ(kBufferSize - 1, this->Header().capacity);
+    ASSERT_EQ(1, this->Header().end);
+
+    ASSERT_EQ(MappedBufferStatus::FORMATTED, buffer.Format(this->region, sizeof(this->region)));
+    ASSERT_EQ(0, buffer.Size());
+}
+
+#if defined(__unix__)
+TEST(MappedBuffer, SurvivesUnmapOfFile)
+{
+    char path[] = "/tmp/libEmbeddedMappedBufferXXXXXX";
+    const int file = mkstemp(path);
+    ASSERT_NE(-1, file);
+    ASSERT_EQ(0, ftruncate(file, BufferT::kRegionSize));
+    for (int run = 0; run < 2; run++)
+    {
+        void *region = mmap(nullptr, BufferT::kRegionSize, PROT_READ | PROT_WRITE, MAP_SHARED, file, 0);
+        ASSERT_NE(MAP_FAILED, region);
+        BufferT buffer;
+        const MappedBufferStatus status = buffer.Attach(region, BufferT::kRegionSize);
+        if (run == 0)
+        {
+            ASSERT_EQ(MappedBufferStatus::FORMATTED, status);
+            buffer.Add(7);
+            buffer.Add(8);
+        }
+        else
+        {
+            ASSERT_EQ(MappedBufferStatus::RECOVERED, status);
+            ASSERT_EQ(2, buffer.Size());
+            EXPECT_EQ(7, buffer[0]);
+            EXPECT_EQ(8, buffer[1]);
+        }
+        munmap(region, BufferT::kRegionSize);
+    }
+    close(file);
+    unlink(path);
+}
+#endif
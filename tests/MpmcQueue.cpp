@@ -0,0 +1,191 @@
+#include <gtest/gtest.h>
+#include "libEmbedded/MpmcQueue.h"
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+using libEmbedded::MpmcQueue;
+constexpr size_t kQueueSize = 8;
+using T = uint32_t;
+using QueueT = MpmcQueue<T, kQueueSize>;
+
+class MpmcQueueFixture : public ::testing::Test
+{
+protected:
+    QueueT queue;
+};
+
+TEST_F(MpmcQueueFixture, PopFromEmptyQueue)
+{
+    T value = 42;
+    ASSERT_FALSE(this->queue.TryPop(value));
+    ASSERT_EQ(42, value);
+    ASSERT_EQ(0, this->queue.Size());
+}
+
+TEST_F(MpmcQueueFixture, PushAndPopInOrder)
+{
+    ASSERT_TRUE(this->queue.TryPush(10));
+    ASSERT_TRUE(this->queue.TryPush(20));
+    ASSERT_EQ(2, this->queue.Size());
+    T value = 0;
+    ASSERT_TRUE(this->queue.TryPop(value));
+    EXPECT_EQ(10, value);
+    ASSERT_TRUE(this->queue.TryPop(value));
+    EXPECT_EQ(20, value);
+    ASSERT_EQ(0, this->queue.Size());
+}
+
+TEST_F(MpmcQueueFixture, PushOnFullQueueFailsAndWrapsAfterPop)
+{
+    for (T round = 0; round < 3; round++)
+    {
+        for (T i = 0; i < kQueueSize; i++)
+        {
+            ASSERT_TRUE(this->queue.TryPush(round * 10 + i));
+        }
+        ASSERT_EQ(kQueueSize, this->queue.Size());
+        ASSERT_FALSE(this->queue.TryPush(100));
+        for (T i = 0; i < kQueueSize; i++)
+        {
+            T value = 0;
+            ASSERT_TRUE(this->queue.TryPop(value));
+            EXPECT_EQ(round * 10 + i, value);
+        }
+    }
+}
+
+TEST(MpmcQueue, DestructorDestroysLeftoverElements)
+{
+    static int destructorCounter = 0;
+    struct tester
+    {
+        ~tester()
+        {
+            destructorCounter++;
+        }
+    };
+
+    {
+        MpmcQueue<tester, 4> queue;
+        queue.TryPush(tester());
+        queue.TryPush(tester());
+        destructorCounter = 0;
+    }
+    EXPECT_EQ(2, destructorCounter);
+}
+
+struct MoveOnly
+{
+    int value;
+
+    explicit MoveOnly(int value = 0) : value(value) {}
+    MoveOnly(const MoveOnly &) = delete;
+    MoveOnly &operator=(const MoveOnly &) = delete;
+    MoveOnly(MoveOnly &&other) : value(other.value)
+    {
+        other.value = -1;
+    }
+    MoveOnly &operator=(MoveOnly &&other)
+    {
+        this->value = other.value;
+        other.value = -1;
+        return *this;
+    }
+};
+
+TEST(MpmcQueue, MoveOnlyElements)
+{
+    MpmcQueue<MoveOnly, 2> queue;
+    MoveOnly element(1);
+    ASSERT_TRUE(queue.TryPush(libEmbedded::move(element)));
+    EXPECT_EQ(-1, element.value);
+    ASSERT_TRUE(queue.TryPush(MoveOnly(2)));
+    MoveOnly rejected(3);
+    ASSERT_FALSE(queue.TryPush(libEmbedded::move(rejected)));
+    EXPECT_EQ(3, rejected.value);
+    ASSERT_TRUE(queue.TryPop(element));
+    EXPECT_EQ(1, element.value);
+    ASSERT_TRUE(queue.TryPop(element));
+    EXPECT_EQ(2, element.value);
+}
+
+TEST(MpmcQueue, MultiProducerMultiConsumerStress)
+{
+    constexpr size_t kThreadCount = 3;
+    constexpr T kItemsPerProducer = 50000;
+    static MpmcQueue<T, 64> queue;
+    std::atomic<uint64_t> sum(0);
+    std::atomic<T> received(0);
+
+    std::thread producers[kThreadCount];
+    std::thread consumers[kThreadCount];
+    for (size_t t = 0; t < kThreadCount; t++)
+    {
+        producers[t] = std::thread([]() {
+            for (T i = 1; i <= kItemsPerProducer;)
+            {
+                if (queue.TryPush(i))
+                {
+                    i++;
+                }
+                else
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+        consumers[t] = std::thread([&sum, &received]() {
+            T value = 0;
+            while (received.load() < kItemsPerProducer * kThreadCount)
+            {
+                if (queue.TryPop(value))
+                {
+                    sum += value;
+                    received++;
+                }
+                else
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (size_t t = 0; t < kThreadCount; t++)
+    {
+        producers[t].join();
+        consumers[t].join();
+    }
+    constexpr uint64_t kExpectedSum = kThreadCount * (static_cast<uint64_t>(kItemsPerProducer) * (kItemsPerProducer + 1) / 2);
+    ASSERT_EQ(kItemsPerProducer * kThreadCount, received.load());
+    ASSERT_EQ(kExpectedSum, sum.load());
+    ASSERT_EQ(0, queue.Size());
+}
+
+TEST(MpmcQueue, BlockingPushTimesOutOnFullQueue)
+{
+    libEmbedded::MpmcQueue<T, 2, libEmbedded::OverflowPolicy::BLOCK> queue;
+    ASSERT_TRUE(queue.Push(1, std::chrono::milliseconds(10)));
+    ASSERT_TRUE(queue.Push(2, std::chrono::milliseconds(10)));
+    ASSERT_FALSE(queue.Push(3, std::chrono::milliseconds(10)));
+    ASSERT_EQ(2, queue.Size());
+}
+
+TEST(MpmcQueue, BlockingPushWaitsForConsumer)
+{
+    libEmbedded::MpmcQueue<T, 2, libEmbedded::OverflowPolicy::BLOCK> queue;
+    ASSERT_TRUE(queue.TryPush(1));
+    ASSERT_TRUE(queue.TryPush(2));
+    std::thread consumer([&queue]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        T value = 0;
+        queue.TryPop(value);
+    });
+    ASSERT_TRUE(queue.Push(3, std::chrono::seconds(10)));
+    consumer.join();
+    T value = 0;
+    ASSERT_TRUE(queue.TryPop(value));
+    EXPECT_EQ(2, value);
+    ASSERT_TRUE(queue.TryPop(value));
+    EXPECT_EQ(3, value);
+}
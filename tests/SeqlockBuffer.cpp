@@ -0,0 +1,72 @@
+#include <gtest/gtest.h>
+#include "libEmbedded/SeqlockBuffer.h"
+#include <atomic>
+#include <thread>
+
+using libEmbedded::SeqlockBuffer;
+constexpr size_t kBufferSize = 16;
+using T = uint32_t;
+using BufferT = SeqlockBuffer<T, kBufferSize>;
+
+TEST(SeqlockBuffer, ReadCopiesContents)
+{
+    BufferT buffer;
+    buffer.Add(1);
+    const T elements[] = {2, 3, 4};
+    buffer.AddRange(elements, 3);
+    buffer.Remove(1);
+
+    BufferT::BufferType snapshot;
+    ASSERT_TRUE(buffer.TryRead(snapshot));
+    ASSERT_EQ(3, snapshot.Size());
+    EXPECT_EQ(2, snapshot[0]);
+    EXPECT_EQ(4, snapshot[2]);
+    EXPECT_EQ(buffer.GetBuffer(), snapshot);
+}
+
+TEST(SeqlockBuffer, ReadOverWrapPoint)
+{
+    BufferT buffer;
+    for (T i = 0; i < kBufferSize + 5; i++)
+    {
+        buffer.Add(i);
+    }
+    BufferT::BufferType snapshot;
+    buffer.Read(snapshot);
+    ASSERT_EQ(kBufferSize, snapshot.Size());
+    T expected = 5;
+    for (T value : snapshot)
+    {
+        EXPECT_EQ(expected++, value);
+    }
+}
+
+TEST(SeqlockBuffer, SnapshotsAreConsistentWhileWriting)
+{
+    constexpr T kWrites = 200000;
+    static BufferT buffer;
+    std::atomic<bool> done(false);
+    std::thread reader([&done]() {
+        BufferT::BufferType snapshot;
+        while (!done.load())
+        {
+            buffer.Read(snapshot);
+            // The writer only adds increasing values, a torn copy would break the sequence.
+            for (size_t i = 1; i < snapshot.Size(); i++)
+            {
+                ASSERT_EQ(snapshot[i - 1] + 1, snapshot[i]);
+            }
+            std::this_thread::yield();
+        }
+    });
+    for (T i = 0; i < kWrites; i++)
+    {
+        buffer.Add(i);
+    }
+    done.store(true);
+    reader.join();
+    BufferT::BufferType snapshot;
+    buffer.Read(snapshot);
+    ASSERT_EQ(kBufferSize, snapshot.Size());
+    EXPECT_EQ(kWrites - 1, snapshot[kBufferSize - 1]);
+}
@@ -0,0 +1,110 @@
+#include <gtest/gtest.h>
+#include "libEmbedded/SlidingWindow.h"
+#include <stdint.h>
+#include <random>
+
+using libEmbedded::SlidingWindow;
+constexpr size_t kWindowSize = 8;
+
+TEST(SlidingWindow, EmptyWindow)
+{
+    SlidingWindow<int32_t, kWindowSize> window;
+    ASSERT_EQ(0, window.Size());
+    ASSERT_EQ(kWindowSize, window.Capacity());
+    EXPECT_EQ(0, window.Sum());
+    EXPECT_EQ(0, window.Mean());
+    EXPECT_EQ(0, window.Variance());
+}
+
+TEST(SlidingWindow, AggregatesOverFullWindow)
+{
+    SlidingWindow<int32_t, kWindowSize> window;
+    window.Add(2);
+    window.Add(4);
+    window.Add(4);
+    window.Add(4);
+    window.Add(5);
+    window.Add(5);
+    window.Add(7);
+    window.Add(9);
+    EXPECT_EQ(40, window.Sum());
+    EXPECT_DOUBLE_EQ(5, window.Mean());
+    EXPECT_DOUBLE_EQ(4, window.Variance());
+    EXPECT_EQ(2, window.Min());
+    EXPECT_EQ(9, window.Max());
+}
+
+TEST(SlidingWindow, MinAndMaxFollowEvictions)
+{
+    SlidingWindow<int32_t, 3> window;
+    window.Add(1);
+    window.Add(9);
+    window.Add(5);
+    EXPECT_EQ(1, window.Min());
+    EXPECT_EQ(9, window.Max());
+    window.Add(6);
+    EXPECT_EQ(5, window.Min());
+    EXPECT_EQ(9, window.Max());
+    window.Add(2);
+    EXPECT_EQ(2, window.Min());
+    EXPECT_EQ(6, window.Max());
+    window.Remove(2);
+    ASSERT_EQ(1, window.Size());
+    EXPECT_EQ(2, window.Min());
+    EXPECT_EQ(2, window.Max());
+    EXPECT_EQ(2, window.Sum());
+}
+
+TEST(SlidingWindow, RemoveEverythingAndRefill)
+{
+    SlidingWindow<int32_t, 3> window;
+    window.Add(3);
+    window.Add(1);
+    window.Remove(10);
+    ASSERT_EQ(0, window.Size());
+    EXPECT_EQ(0, window.Sum());
+    window.Add(7);
+    EXPECT_EQ(7, window.Min());
+    EXPECT_EQ(7, window.Max());
+    EXPECT_EQ(7, window.GetBuffer()[0]);
+}
+
+TEST(SlidingWindow, MatchesRecomputingEverySample)
+{
+    SlidingWindow<int32_t, kWindowSize, int64_t> window;
+    std::mt19937 generator(1234);
+    std::uniform_int_distribution<int32_t> distribution(-1000, 1000);
+    for (size_t i = 0; i < 1000; i++)
+    {
+        window.Add(distribution(generator));
+        if (i % 97 == 0)
+        {
+            window.Remove(3);
+        }
+        if (window.Size() == 0)
+        {
+            continue;
+        }
+        int64_t sum = 0;
+        int32_t minimum = window.GetBuffer()[0];
+        int32_t maximum = window.GetBuffer()[0];
+        for (int32_t value : window.GetBuffer())
+        {
+            sum += value;
+            minimum = value < minimum ? value : minimum;
+            maximum = value > maximum ? value : maximum;
+        }
+        const double mean = static_cast<double>(sum) / window.Size();
+        double variance = 0;
+        for (int32_t value : window.GetBuffer())
+        {
+            variance += (value - mean) * (value - mean);
+        }
+        variance /= window.Size();
+        ASSERT_EQ(sum, window.Sum());
+        ASSERT_EQ(minimum, window.Min());
+        ASSERT_EQ(maximum, window.Max());
+        ASSERT_NEAR(mean, window.Mean(), 1e-9);
+        ASSERT_NEAR(variance, window.Variance(), 1e-6);
+    }
+}
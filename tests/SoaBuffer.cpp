@@ -0,0 +1,122 @@
+#include <gtest/gtest.h>
+#include "libEmbedded/SoaBuffer.h"
+#include <stdint.h>
+#include <vector>
+
+using libEmbedded::BufferSegments;
+using libEmbedded::SoaBuffer;
+using libEmbedded::Span;
+
+// timestamp, x, y, status
+using RecordBuffer = SoaBuffer<4, uint32_t, float, float, uint8_t>;
+
+template <typename T>
+static std::vector<typename libEmbedded::remove_const<T>::type> Collect(const BufferSegments<T> &segments)
+{
+    std::vector<typename libEmbedded::remove_const<T>::type> values(segments.first.begin(), segments.first.end());
+    values.insert(values.end(), segments.second.begin(), segments.second.end());
+    return values;
+}
+
+TEST(SoaBuffer, FieldTypes)
+{
+    static_assert(RecordBuffer::kFieldCount == 4, "Four fields expected.");
+    static_assert(libEmbedded::is_same<RecordBuffer::FieldType<1>, float>::value, "Field 1 is a float.");
+    static_assert(libEmbedded::is_same<RecordBuffer::FieldType<3>, uint8_t>::value, "Field 3 is a uint8_t.");
+    RecordBuffer buffer;
+    EXPECT_EQ(0, buffer.Size());
+    EXPECT_EQ(4, buffer.Capacity());
+    EXPECT_EQ(0, buffer.GetColumn<0>().Size());
+}
+
+TEST(SoaBuffer, AddAndGet)
+{
+    RecordBuffer buffer;
+    buffer.Add(100, 1.0f, 2.0f, 1);
+    buffer.Add(200, 3.0f, 4.0f, 0);
+    ASSERT_EQ(2, buffer.Size());
+    EXPECT_EQ(100, buffer.Get<0>(0));
+    EXPECT_EQ(4.0f, buffer.Get<2>(1));
+    EXPECT_EQ(0, buffer.Get<3>(1));
+
+    buffer.Get<1>(0) = 5.0f;
+    const RecordBuffer &constBuffer = buffer;
+    EXPECT_EQ(5.0f, constBuffer.Get<1>(0));
+}
+
+TEST(SoaBuffer, ColumnsAreContiguous)
+{
+    RecordBuffer buffer;
+    buffer.Add(100, 1.0f, 2.0f, 1);
+    buffer.Add(200, 3.0f, 4.0f, 0);
+    buffer.Add(300, 5.0f, 6.0f, 1);
+    BufferSegments<float> x = buffer.GetColumn<1>();
+    ASSERT_EQ(3, x.first.end() - x.first.begin());
+    EXPECT_EQ(0, x.second.end() - x.second.begin());
+    EXPECT_EQ(&x.first[0] + 2, &x.first[2]);
+    EXPECT_EQ((std::vector<float>{1.0f, 3.0f, 5.0f}), Collect(x));
+
+    // Columns can be changed in place.
+    for (float &value : x.first)
+    {
+        value *= 2;
+    }
+    EXPECT_EQ(10.0f, buffer.Get<1>(2));
+}
+
+TEST(SoaBuffer, DropsOldestWhenFull)
+{
+    RecordBuffer buffer;
+    for (uint32_t i = 0; i < 6; i++)
+    {
+        buffer.Add(i, static_cast<float>(i), 0.0f, static_cast<uint8_t>(i % 2));
+    }
+    ASSERT_EQ(4, buffer.Size());
+    EXPECT_EQ(2, buffer.Get<0>(0));
+    EXPECT_EQ(5, buffer.Get<0>(3));
+    const RecordBuffer &constBuffer = buffer;
+    BufferSegments<const uint32_t> timestamps = constBuffer.GetColumn<0>();
+    // Wrapped around the end of the column.
+    EXPECT_EQ(2, timestamps.first.end() - timestamps.first.begin());
+    EXPECT_EQ((std::vector<uint32_t>{2, 3, 4, 5}), Collect(timestamps));
+    EXPECT_EQ((std::vector<uint8_t>{0, 1, 0, 1}), Collect(constBuffer.GetColumn<3>()));
+}
+
+TEST(SoaBuffer, LinearizeMakesColumnsOneSegment)
+{
+    RecordBuffer buffer;
+    for (uint32_t i = 0; i < 7; i++)
+    {
+        buffer.Add(i, static_cast<float>(i) / 2, static_cast<float>(i) * 2, static_cast<uint8_t>(i));
+    }
+    buffer.Remove(1);
+    buffer.Linearize();
+    ASSERT_EQ(3, buffer.Size());
+    BufferSegments<uint32_t> timestamps = buffer.GetColumn<0>();
+    EXPECT_EQ(3, timestamps.first.end() - timestamps.first.begin());
+    EXPECT_EQ(0, timestamps.second.end() - timestamps.second.begin());
+    EXPECT_EQ((std::vector<uint32_t>{4, 5, 6}), Collect(timestamps));
+    EXPECT_EQ((std::vector<float>{2.0f, 2.5f, 3.0f}), Collect(buffer.GetColumn<1>()));
+    EXPECT_EQ((std::vector<float>{8.0f, 10.0f, 12.0f}), Collect(buffer.GetColumn<2>()));
+    EXPECT_EQ((std::vector<uint8_t>{4, 5, 6}), Collect(buffer.GetColumn<3>()));
+
+    // Adding after linearizing continues as normal.
+    buffer.Add(7, 3.5f, 14.0f, 7);
+    EXPECT_EQ((std::vector<uint32_t>{4, 5, 6, 7}), Collect(buffer.GetColumn<0>()));
+}
+
+TEST(SoaBuffer, RemoveAndClear)
+{
+    RecordBuffer buffer;
+    buffer.Add(1, 1.0f, 1.0f, 1);
+    buffer.Add(2, 2.0f, 2.0f, 2);
+    buffer.Remove(1);
+    ASSERT_EQ(1, buffer.Size());
+    EXPECT_EQ(2, buffer.Get<0>(0));
+    buffer.Remove(5);
+    EXPECT_EQ(0, buffer.Size());
+    buffer.Add(3, 3.0f, 3.0f, 3);
+    buffer.Clear();
+    EXPECT_EQ(0, buffer.Size());
+    EXPECT_EQ(0, buffer.GetColumn<2>().Size());
+}
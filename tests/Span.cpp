@@ -3,6 +3,7 @@
 #include "libEmbedded/Iterator.h"
 #include <limits.h>
 #include <array>
+#include <list>
 
 using libEmbedded::Span;
 constexpr size_t kArraySize = 5;
@@ -498,3 +499,107 @@ TYPED_TEST(SpanTFixture, RetrieveFromChangingSubStorage)
     ASSERT_EQ(40, span[3]);
 }
 
+
+TEST(SpanIndexing, LargeSpanIndexingIsLinear)
+{
+    constexpr size_t kSize = 65536;
+    static uint32_t values[kSize];
+    Span<uint32_t> span(values, kSize);
+    for (size_t i = 0; i < kSize; i++)
+    {
+        span[i] = static_cast<uint32_t>(i);
+    }
+    uint64_t sum = 0;
+    const Span<const uint32_t> constSpan(values, kSize);
+    for (size_t i = 0; i < kSize; i++)
+    {
+        sum += constSpan[i];
+    }
+    EXPECT_EQ(static_cast<uint64_t>(kSize) * (kSize - 1) / 2, sum);
+    EXPECT_EQ(&values[kSize - 1], &span[kSize - 1]);
+}
+
+static constexpr uint8_t kSliceData[10] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+TEST(SpanSlicing, SubspanFirstLastAreConstexpr)
+{
+    constexpr Span<const uint8_t> span(kSliceData, kSliceData + 10);
+    static_assert(span.Subspan(2, 3).begin() == kSliceData + 2, "Failed.");
+    static_assert(span.Subspan(2, 3).end() == kSliceData + 5, "Failed.");
+    static_assert(span.Subspan(7).end() == kSliceData + 10, "Failed.");
+    static_assert(span.First(4).end() == kSliceData + 4, "Failed.");
+    static_assert(span.Last(4).begin() == kSliceData + 6, "Failed.");
+    static_assert(span.SplitAt(3).first.end() == kSliceData + 3, "Failed.");
+    static_assert(span.SplitAt(3).second.begin() == kSliceData + 3, "Failed.");
+    EXPECT_EQ(3, span.Subspan(2, 3)[1]);
+}
+
+TEST(SpanSlicing, SlicesShareTheData)
+{
+    uint8_t data[6] = {0, 1, 2, 3, 4, 5};
+    Span<uint8_t> span(data, data + 6);
+    Span<uint8_t> middle = span.Subspan(1, 4);
+    EXPECT_EQ(4, libEmbedded::Distance(middle));
+    middle[0] = 10;
+    middle.Last(1)[0] = 40;
+    EXPECT_EQ(10, data[1]);
+    EXPECT_EQ(40, data[4]);
+    libEmbedded::SpanSplit<Span<uint8_t>> halves = span.SplitAt(6);
+    EXPECT_EQ(6, libEmbedded::Distance(halves.first));
+    EXPECT_EQ(halves.second.begin(), halves.second.end());
+    EXPECT_EQ(span.First(0).begin(), span.First(0).end());
+}
+
+TEST(SpanSlicing, ChunksCoverTheSpan)
+{
+    Span<const uint8_t> span(kSliceData, kSliceData + 10);
+    EXPECT_EQ(3, span.Chunks(4).Count());
+    size_t expected = 0;
+    size_t chunks = 0;
+    for (Span<const uint8_t> chunk : span.Chunks(4))
+    {
+        EXPECT_EQ(chunks < 2 ? 4 : 2, libEmbedded::Distance(chunk));
+        for (uint8_t value : chunk)
+        {
+            EXPECT_EQ(expected++, value);
+        }
+        chunks++;
+    }
+    EXPECT_EQ(3, chunks);
+    EXPECT_EQ(10, expected);
+    EXPECT_EQ(1, span.Chunks(10).Count());
+    EXPECT_EQ(0, span.First(0).Chunks(3).Count());
+    EXPECT_EQ(span.First(0).Chunks(3).begin(), span.First(0).Chunks(3).end());
+}
+
+TEST(SpanSlicing, ChunksOverForwardIterators)
+{
+    std::list<int> values = {1, 2, 3, 4, 5};
+    using ListSpan = Span<int, std::list<int>::iterator, std::list<int>::const_iterator>;
+    ListSpan span(values.begin(), values.end());
+    EXPECT_EQ(3, *span.Subspan(2, 2).begin());
+    EXPECT_EQ(5, *span.Last(1).begin());
+    int sum = 0;
+    size_t chunks = 0;
+    for (ListSpan chunk : span.Chunks(2))
+    {
+        sum += *chunk.begin();
+        chunks++;
+    }
+    EXPECT_EQ(3, chunks);
+    EXPECT_EQ(1 + 3 + 5, sum);
+}
+
+static uint8_t mutableData[4];
+
+TEST(SpanIndexing, ConstexprIndexing)
+{
+    constexpr Span<const uint8_t> span(kSliceData, kSliceData + 10);
+    static_assert(span[0] == 0, "Failed.");
+    static_assert(span[9] == 9, "Failed.");
+    static_assert(span.Subspan(3, 4)[2] == 5, "Failed.");
+    // The const overload of a modifiable span is usable in constant expressions too.
+    static constexpr Span<uint8_t> mutableSpan(mutableData, mutableData + 4);
+    static_assert(&mutableSpan[3] == mutableData + 3, "Failed.");
+    EXPECT_EQ(9, span[9]);
+}
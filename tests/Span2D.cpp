@@ -0,0 +1,111 @@
+#include <gtest/gtest.h>
+#include "libEmbedded/Span2D.h"
+#include "libEmbedded/SpanAlgorithm.h"
+#include <stdint.h>
+
+using libEmbedded::Span2D;
+
+constexpr size_t kRows = 4;
+constexpr size_t kColumns = 5;
+// Rows are padded to 6 elements, the padding is 0xFFFF.
+constexpr size_t kPitch = 6;
+
+class Span2DFixture : public ::testing::Test
+{
+protected:
+    uint16_t frame[kRows * kPitch];
+
+    void SetUp() override
+    {
+        for (size_t row = 0; row < kRows; row++)
+        {
+            for (size_t column = 0; column < kPitch; column++)
+            {
+                frame[row * kPitch + column] = column < kColumns ? static_cast<uint16_t>(row * 10 + column) : 0xFFFF;
+            }
+        }
+    }
+};
+
+TEST_F(Span2DFixture, IndexRowsAndColumns)
+{
+    Span2D<uint16_t> view(this->frame, kRows, kColumns, kPitch);
+    EXPECT_EQ(kRows, view.Rows());
+    EXPECT_EQ(kColumns, view.Columns());
+    EXPECT_FALSE(view.IsContiguous());
+    EXPECT_EQ(23, view(2, 3));
+
+    libEmbedded::Span<uint16_t> row = view.Row(3);
+    EXPECT_EQ(kColumns, libEmbedded::Distance(row));
+    EXPECT_EQ(30, row[0]);
+    EXPECT_FALSE(libEmbedded::Contains(row, 0xFFFF));
+
+    libEmbedded::StridedSpan<uint16_t> column = view.Column(4);
+    EXPECT_EQ(kRows, column.Size());
+    uint16_t expected = 4;
+    for (uint16_t value : column)
+    {
+        EXPECT_EQ(expected, value);
+        expected += 10;
+    }
+    column[1] = 99;
+    EXPECT_EQ(99, view(1, 4));
+    EXPECT_EQ(1, libEmbedded::Count(column, 99));
+}
+
+TEST_F(Span2DFixture, SubviewKeepsThePitch)
+{
+    Span2D<const uint16_t> view = Span2D<uint16_t>(this->frame, kRows, kColumns, kPitch);
+    Span2D<const uint16_t> part = view.Subview(1, 2, 2, 3);
+    EXPECT_EQ(2, part.Rows());
+    EXPECT_EQ(3, part.Columns());
+    EXPECT_EQ(kPitch, part.Pitch());
+    EXPECT_EQ(12, part(0, 0));
+    EXPECT_EQ(24, part(1, 2));
+    EXPECT_EQ(14, part.Column(2)[0]);
+    EXPECT_EQ(22, part.Row(1)[0]);
+    EXPECT_TRUE(Span2D<uint16_t>(this->frame, kRows, kPitch).IsContiguous());
+}
+
+TEST_F(Span2DFixture, TilesCoverTheViewOnce)
+{
+    Span2D<uint16_t> view(this->frame, kRows, kColumns, kPitch);
+    auto tiles = view.Tiles(3, 2);
+    EXPECT_EQ(2, tiles.TileRows());
+    EXPECT_EQ(3, tiles.TileColumns());
+    EXPECT_EQ(6, tiles.Count());
+    size_t visited = 0;
+    size_t count = 0;
+    for (Span2D<uint16_t> tile : tiles)
+    {
+        EXPECT_LE(tile.Rows(), 3);
+        EXPECT_LE(tile.Columns(), 2);
+        for (size_t row = 0; row < tile.Rows(); row++)
+        {
+            for (uint16_t &value : tile.Row(row))
+            {
+                value += 1000;
+                visited++;
+            }
+        }
+        count++;
+    }
+    EXPECT_EQ(6, count);
+    EXPECT_EQ(kRows * kColumns, visited);
+    // Every element once, the padding never.
+    EXPECT_EQ(1000, view(0, 0));
+    EXPECT_EQ(1034, view(3, 4));
+    EXPECT_EQ(0xFFFF, this->frame[kPitch - 1]);
+    // The bottom right tile holds the remainder.
+    Span2D<uint16_t> last = tiles.Tile(1, 2);
+    EXPECT_EQ(1, last.Rows());
+    EXPECT_EQ(1, last.Columns());
+}
+
+TEST(Span2D, EmptyViewHasNoTiles)
+{
+    uint8_t data[1] = {};
+    Span2D<uint8_t> empty(data, 0, 4);
+    EXPECT_EQ(0, empty.Tiles(2, 2).Count());
+    EXPECT_EQ(empty.Tiles(2, 2).begin(), empty.Tiles(2, 2).end());
+}
@@ -0,0 +1,147 @@
+#include <gtest/gtest.h>
+#include "libEmbedded/SpanAlgorithm.h"
+#include "libEmbedded/Span.h"
+#include "libEmbedded/StaticSpan.h"
+#include <stdint.h>
+#include <string.h>
+#include <list>
+#include <vector>
+#include <array>
+
+using libEmbedded::Span;
+
+TEST(SpanAlgorithm, EqualComparesContents)
+{
+    uint8_t a[4] = {1, 2, 3, 4};
+    uint8_t b[4] = {1, 2, 3, 4};
+    Span<uint8_t> spanA(a, a + 4);
+    Span<const uint8_t> spanB(b, b + 4);
+    EXPECT_FALSE(spanA == Span<uint8_t>(b, b + 4));
+    EXPECT_TRUE(libEmbedded::Equal(spanA, spanB));
+    EXPECT_FALSE(libEmbedded::Equal(spanA, spanB.First(3)));
+    b[3] = 5;
+    EXPECT_FALSE(libEmbedded::Equal(spanA, spanB));
+    EXPECT_TRUE(libEmbedded::Equal(spanA.First(0), spanB.Last(0)));
+}
+
+TEST(SpanAlgorithm, EqualOnNonIntegralAndNonContiguous)
+{
+    double a[2] = {0.0, 1.5};
+    double b[2] = {-0.0, 1.5};
+    // Bytes differ but the values are equal, so this must not use memcmp.
+    EXPECT_TRUE(libEmbedded::Equal(Span<double>(a, a + 2), Span<double>(b, b + 2)));
+    std::list<int> list = {1, 2, 3};
+    int values[3] = {1, 2, 3};
+    EXPECT_TRUE(libEmbedded::Equal(list, Span<int>(values, values + 3)));
+    values[2] = 4;
+    EXPECT_FALSE(libEmbedded::Equal(list, Span<int>(values, values + 3)));
+}
+
+TEST(SpanAlgorithm, CompareIsLexicographic)
+{
+    uint8_t a[3] = {1, 200, 3};
+    uint8_t b[3] = {1, 100, 3};
+    Span<uint8_t> spanA(a, a + 3);
+    Span<uint8_t> spanB(b, b + 3);
+    EXPECT_EQ(1, libEmbedded::Compare(spanA, spanB));
+    EXPECT_EQ(-1, libEmbedded::Compare(spanB, spanA));
+    EXPECT_EQ(0, libEmbedded::Compare(spanA, spanA));
+    EXPECT_EQ(-1, libEmbedded::Compare(spanA.First(2), spanA));
+    EXPECT_EQ(1, libEmbedded::Compare(spanA, spanA.First(2)));
+
+    int8_t c[2] = {-1, 0};
+    int8_t d[2] = {1, 0};
+    // Signed bytes can't use memcmp, -1 is smaller than 1.
+    EXPECT_EQ(-1, libEmbedded::Compare(Span<int8_t>(c, c + 2), Span<int8_t>(d, d + 2)));
+    int32_t e[2] = {256, 0};
+    int32_t f[2] = {1, 0};
+    EXPECT_EQ(1, libEmbedded::Compare(Span<int32_t>(e, e + 2), Span<int32_t>(f, f + 2)));
+}
+
+TEST(SpanAlgorithm, FillAndCopyTo)
+{
+    uint8_t bytes[8] = {};
+    libEmbedded::Fill(Span<uint8_t>(bytes, bytes + 8).Subspan(2, 4), 0xAA);
+    EXPECT_EQ(0, bytes[1]);
+    EXPECT_EQ(0xAA, bytes[2]);
+    EXPECT_EQ(0xAA, bytes[5]);
+    EXPECT_EQ(0, bytes[6]);
+
+    uint32_t words[4] = {};
+    libEmbedded::Fill(Span<uint32_t>(words, words + 4), 0x12345678u);
+    EXPECT_EQ(0x12345678u, words[3]);
+
+    uint8_t destination[3] = {};
+    EXPECT_EQ(3, libEmbedded::CopyTo(Span<const uint8_t>(bytes, bytes + 8).Subspan(1), Span<uint8_t>(destination, destination + 3)));
+    EXPECT_EQ(0, destination[0]);
+    EXPECT_EQ(0xAA, destination[2]);
+
+    // Overlapping copy to the front.
+    uint8_t overlap[5] = {1, 2, 3, 4, 5};
+    Span<uint8_t> span(overlap, overlap + 5);
+    EXPECT_EQ(4, libEmbedded::CopyTo(span.Subspan(1), span));
+    EXPECT_EQ(5, overlap[3]);
+
+    std::list<int> list = {7, 8};
+    int copies[4] = {};
+    EXPECT_EQ(2, libEmbedded::CopyTo(list, libEmbedded::StaticSpan<int, 4>(copies)));
+    EXPECT_EQ(8, copies[1]);
+    EXPECT_EQ(0, copies[2]);
+}
+
+TEST(SpanAlgorithm, FillAndCopyToWriteIntoContainers)
+{
+    std::vector<uint8_t> bytes(4, 0);
+    libEmbedded::Fill(bytes, 7);
+    EXPECT_EQ(7, bytes[0]);
+    EXPECT_EQ(7, bytes[3]);
+
+    std::vector<int> words(3, 0);
+    libEmbedded::Fill(words, 9);
+    EXPECT_EQ(9, words[2]);
+
+    const uint8_t source[4] = {1, 2, 3, 4};
+    std::array<uint8_t, 4> array = {};
+    EXPECT_EQ(4, libEmbedded::CopyTo(Span<const uint8_t>(source, source + 4), array));
+    EXPECT_EQ(4, array[3]);
+    EXPECT_EQ(3, libEmbedded::CopyTo(Span<const uint8_t>(source, source + 3), bytes));
+    EXPECT_EQ(3, bytes[2]);
+    EXPECT_EQ(7, bytes[3]);
+}
+
+TEST(SpanAlgorithm, FillBoolStoresTrue)
+{
+    bool flags[3] = {};
+    libEmbedded::Fill(Span<bool>(flags, flags + 3), 2);
+    EXPECT_TRUE(flags[0]);
+    EXPECT_TRUE(flags[2]);
+    uint8_t raw;
+    memcpy(&raw, &flags[1], 1);
+    EXPECT_EQ(1, raw);
+    EXPECT_TRUE(libEmbedded::Contains(Span<bool>(flags, flags + 3), true));
+}
+
+TEST(SpanAlgorithm, FindCountContains)
+{
+    const uint8_t bytes[6] = {5, 1, 5, 44, 5, 9};
+    Span<const uint8_t> span(bytes, bytes + 6);
+    EXPECT_EQ(bytes + 3, libEmbedded::Find(span, 44));
+    EXPECT_EQ(span.end(), libEmbedded::Find(span, 7));
+    // 300 has the same low byte as 44 but is not in the span.
+    EXPECT_EQ(span.end(), libEmbedded::Find(span, 300));
+    EXPECT_FALSE(libEmbedded::Contains(span, 300));
+    EXPECT_TRUE(libEmbedded::Contains(span, 9));
+    EXPECT_EQ(3, libEmbedded::Count(span, 5));
+    EXPECT_EQ(0, libEmbedded::Count(span.First(0), 5));
+    EXPECT_EQ(span.end(), libEmbedded::Find(span.Last(0), 9));
+
+    const int32_t words[4] = {1, 257, 2, 257};
+    Span<const int32_t> wordSpan(words, words + 4);
+    EXPECT_EQ(words + 1, libEmbedded::Find(wordSpan, 257));
+    EXPECT_EQ(2, libEmbedded::Count(wordSpan, 257));
+    EXPECT_FALSE(libEmbedded::Contains(wordSpan, 3));
+
+    std::list<int> list = {4, 6, 4};
+    EXPECT_EQ(2, libEmbedded::Count(list, 4));
+    EXPECT_EQ(6, *libEmbedded::Find(list, 6));
+}
@@ -0,0 +1,233 @@
+#include <gtest/gtest.h>
+#include "libEmbedded/SpscQueue.h"
+#include <chrono>
+#include <thread>
+
+using libEmbedded::SpscQueue;
+constexpr size_t kQueueSize = 5;
+using T = uint32_t;
+using QueueT = SpscQueue<T, kQueueSize>;
+
+class SpscQueueFixture : public ::testing::Test
+{
+protected:
+    QueueT queue;
+};
+
+TEST_F(SpscQueueFixture, PopFromEmptyQueue)
+{
+    T value = 42;
+    ASSERT_FALSE(this->queue.TryPop(value));
+    ASSERT_EQ(42, value);
+    ASSERT_EQ(0, this->queue.Size());
+}
+
+TEST_F(SpscQueueFixture, PushAndPopInOrder)
+{
+    ASSERT_TRUE(this->queue.TryPush(10));
+    ASSERT_TRUE(this->queue.TryPush(20));
+    ASSERT_EQ(2, this->queue.Size());
+    T value = 0;
+    ASSERT_TRUE(this->queue.TryPop(value));
+    EXPECT_EQ(10, value);
+    ASSERT_TRUE(this->queue.TryPop(value));
+    EXPECT_EQ(20, value);
+    ASSERT_EQ(0, this->queue.Size());
+}
+
+TEST_F(SpscQueueFixture, PushOnFullQueueFails)
+{
+    for (T i = 0; i < kQueueSize; i++)
+    {
+        ASSERT_TRUE(this->queue.TryPush(i));
+    }
+    ASSERT_EQ(kQueueSize, this->queue.Size());
+    ASSERT_FALSE(this->queue.TryPush(100));
+    T value = 0;
+    ASSERT_TRUE(this->queue.TryPop(value));
+    EXPECT_EQ(0, value);
+    ASSERT_TRUE(this->queue.TryPush(100));
+}
+
+TEST_F(SpscQueueFixture, PushRangeOnlyAddsWhatFits)
+{
+    T values[7] = {1, 2, 3, 4, 5, 6, 7};
+    ASSERT_TRUE(this->queue.TryPush(0));
+    ASSERT_EQ(kQueueSize - 1, this->queue.TryPushRange(values, 7));
+    ASSERT_EQ(kQueueSize, this->queue.Size());
+    T out[7] = {0};
+    ASSERT_EQ(kQueueSize, this->queue.TryPopRange(out, 7));
+    EXPECT_EQ(0, out[0]);
+    EXPECT_EQ(1, out[1]);
+    EXPECT_EQ(4, out[4]);
+    ASSERT_EQ(0, this->queue.Size());
+}
+
+TEST_F(SpscQueueFixture, PopRangeOverWrapPoint)
+{
+    T values[4] = {1, 2, 3, 4};
+    ASSERT_EQ(4, this->queue.TryPushRange(values, 4));
+    T out[4] = {0};
+    ASSERT_EQ(3, this->queue.TryPopRange(out, 3));
+    ASSERT_EQ(4, this->queue.TryPushRange(values, 4));
+    ASSERT_EQ(4, this->queue.TryPopRange(out, 4));
+    EXPECT_EQ(4, out[0]);
+    EXPECT_EQ(1, out[1]);
+    EXPECT_EQ(2, out[2]);
+    EXPECT_EQ(3, out[3]);
+}
+
+TEST(SpscQueue, DestructorDestroysLeftoverElements)
+{
+    static int destructorCounter = 0;
+    struct tester
+    {
+        ~tester()
+        {
+            destructorCounter++;
+        }
+    };
+
+    {
+        SpscQueue<tester, 4> queue;
+        queue.TryPush(tester());
+        queue.TryPush(tester());
+        destructorCounter = 0;
+    }
+    EXPECT_EQ(2, destructorCounter);
+}
+
+struct MoveOnly
+{
+    int value;
+
+    explicit MoveOnly(int value = 0) : value(value) {}
+    MoveOnly(const MoveOnly &) = delete;
+    MoveOnly &operator=(const MoveOnly &) = delete;
+    MoveOnly(MoveOnly &&other) : value(other.value)
+    {
+        other.value = -1;
+    }
+    MoveOnly &operator=(MoveOnly &&other)
+    {
+        this->value = other.value;
+        other.value = -1;
+        return *this;
+    }
+};
+
+TEST(SpscQueue, MoveOnlyElements)
+{
+    SpscQueue<MoveOnly, 4> queue;
+    MoveOnly element(1);
+    ASSERT_TRUE(queue.TryPush(libEmbedded::move(element)));
+    EXPECT_EQ(-1, element.value);
+    ASSERT_TRUE(queue.TryPush(MoveOnly(2)));
+    ASSERT_TRUE(queue.TryPush(MoveOnly(3)));
+    ASSERT_TRUE(queue.TryPop(element));
+    EXPECT_EQ(1, element.value);
+    MoveOnly elements[2];
+    ASSERT_EQ(2, queue.TryPopRange(elements, 2));
+    EXPECT_EQ(2, elements[0].value);
+    EXPECT_EQ(3, elements[1].value);
+}
+
+TEST(SpscQueue, TwoThreadStress)
+{
+    constexpr T kItemCount = 200000;
+    static SpscQueue<T, 64> queue;
+
+    std::thread producer([]() {
+        T next = 0;
+        T batch[8];
+        while (next < kItemCount)
+        {
+            if (next % 3 == 0)
+            {
+                if (queue.TryPush(next))
+                {
+                    next++;
+                }
+                else
+                {
+                    std::this_thread::yield();
+                }
+            }
+            else
+            {
+                size_t count = 0;
+                while (count < 8 && next + count < kItemCount)
+                {
+                    batch[count] = next + count;
+                    count++;
+                }
+                size_t pushed = queue.TryPushRange(batch, count);
+                if (pushed == 0)
+                {
+                    std::this_thread::yield();
+                }
+                next += pushed;
+            }
+        }
+    });
+
+    T expected = 0;
+    bool inOrder = true;
+    T batch[5];
+    while (expected < kItemCount)
+    {
+        if (expected % 2 == 0)
+        {
+            T value = 0;
+            if (queue.TryPop(value))
+            {
+                inOrder = inOrder && value == expected;
+                expected++;
+            }
+            else
+            {
+                std::this_thread::yield();
+            }
+        }
+        else
+        {
+            size_t count = queue.TryPopRange(batch, 5);
+            if (count == 0)
+            {
+                std::this_thread::yield();
+            }
+            for (size_t i = 0; i < count; i++)
+            {
+                inOrder = inOrder && batch[i] == expected;
+                expected++;
+            }
+        }
+    }
+    producer.join();
+    ASSERT_TRUE(inOrder);
+    ASSERT_EQ(0, queue.Size());
+}
+
+TEST(SpscQueue, BlockingPushTimesOutOnFullQueue)
+{
+    libEmbedded::SpscQueue<T, 1, libEmbedded::OverflowPolicy::BLOCK> queue;
+    ASSERT_TRUE(queue.Push(1, std::chrono::milliseconds(10)));
+    ASSERT_FALSE(queue.Push(2, std::chrono::milliseconds(10)));
+    ASSERT_EQ(1, queue.Size());
+}
+
+TEST(SpscQueue, BlockingPushWaitsForConsumer)
+{
+    libEmbedded::SpscQueue<T, 1, libEmbedded::OverflowPolicy::BLOCK> queue;
+    ASSERT_TRUE(queue.TryPush(1));
+    std::thread consumer([&queue]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        T value = 0;
+        queue.TryPop(value);
+    });
+    ASSERT_TRUE(queue.Push(2, std::chrono::seconds(10)));
+    consumer.join();
+    T value = 0;
+    ASSERT_TRUE(queue.TryPop(value));
+    EXPECT_EQ(2, value);
+}
@@ -0,0 +1,79 @@
+#include <gtest/gtest.h>
+#include "libEmbedded/StaticSpan.h"
+#include <type_traits>
+#include <stdint.h>
+
+using libEmbedded::Span;
+using libEmbedded::StaticSpan;
+
+static constexpr uint8_t kMac[6] = {0x00, 0x1A, 0x2B, 0x3C, 0x4D, 0x5E};
+
+static uint32_t Sum(StaticSpan<const uint8_t, 6> mac)
+{
+    uint32_t sum = 0;
+    for (uint8_t value : mac)
+    {
+        sum += value;
+    }
+    return sum;
+}
+
+TEST(StaticSpan, OnlyStoresAPointer)
+{
+    static_assert(sizeof(StaticSpan<uint8_t, 6>) == sizeof(uint8_t *), "Failed.");
+    static_assert(sizeof(StaticSpan<uint8_t, 6>) * 2 == sizeof(Span<uint8_t>), "Failed.");
+    static_assert(StaticSpan<uint8_t, 6>::Size() == 6, "Failed.");
+    static_assert(StaticSpan<uint8_t, 6>::kExtent == 6, "Failed.");
+}
+
+TEST(StaticSpan, ConstructFromArray)
+{
+    constexpr StaticSpan<const uint8_t, 6> mac(kMac);
+    static_assert(mac[1] == 0x1A, "Failed.");
+    static_assert(mac.end() == kMac + 6, "Failed.");
+    EXPECT_EQ(0x00 + 0x1A + 0x2B + 0x3C + 0x4D + 0x5E, Sum(kMac));
+    // A array of the wrong size does not convert.
+    static_assert(!std::is_constructible<StaticSpan<const uint8_t, 6>, const uint8_t (&)[4]>::value, "Failed.");
+}
+
+TEST(StaticSpan, WritesThrough)
+{
+    uint8_t data[4] = {1, 2, 3, 4};
+    StaticSpan<uint8_t, 4> span(data);
+    span[2] = 30;
+    for (uint8_t &value : span.Last<2>())
+    {
+        value++;
+    }
+    EXPECT_EQ(31, data[2]);
+    EXPECT_EQ(5, data[3]);
+    StaticSpan<const uint8_t, 4> readonly = span;
+    EXPECT_EQ(data, readonly.cbegin());
+}
+
+TEST(StaticSpan, CompileTimeSlices)
+{
+    constexpr StaticSpan<const uint8_t, 6> mac(kMac);
+    static_assert(mac.First<3>().begin() == kMac, "Failed.");
+    static_assert(mac.First<3>().Size() == 3, "Failed.");
+    static_assert(mac.Last<3>().begin() == kMac + 3, "Failed.");
+    static_assert(mac.Subspan<2, 2>().begin() == kMac + 2, "Failed.");
+    static_assert(mac.Subspan<2, 2>().end() == kMac + 4, "Failed.");
+    static_assert(mac.Subspan<6, 0>().begin() == kMac + 6, "Failed.");
+}
+
+TEST(StaticSpan, ConvertsToAndFromSpan)
+{
+    uint8_t data[8] = {0, 1, 2, 3, 4, 5, 6, 7};
+    StaticSpan<uint8_t, 8> fixed(data);
+    Span<uint8_t> dynamic = fixed;
+    EXPECT_EQ(data, dynamic.begin());
+    EXPECT_EQ(8, libEmbedded::Distance(dynamic));
+    EXPECT_EQ(dynamic, fixed.AsSpan());
+
+    StaticSpan<uint8_t, 4> back = libEmbedded::ToStaticSpan<4>(dynamic.Subspan(2));
+    EXPECT_EQ(data + 2, back.begin());
+    EXPECT_EQ(5, back[3]);
+    StaticSpan<const uint8_t, 2> readonly = libEmbedded::ToStaticSpan<2>(Span<const uint8_t>(kMac, kMac + 6));
+    EXPECT_EQ(0x1A, readonly[1]);
+}
@@ -0,0 +1,54 @@
+#include <gtest/gtest.h>
+#include "libEmbedded/StridedSpan.h"
+#include "libEmbedded/Iterator.h"
+#include "libEmbedded/TypeTrait.h"
+#include <stdint.h>
+
+using libEmbedded::StridedSpan;
+
+TEST(StridedSpan, VisitsEveryStrideElement)
+{
+    uint16_t data[10] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    StridedSpan<uint16_t> span(data + 1, 3, 3);
+    EXPECT_EQ(3, span.Size());
+    EXPECT_EQ(3, span.Stride());
+    EXPECT_EQ(4, span[1]);
+    uint16_t expected = 1;
+    for (uint16_t value : span)
+    {
+        EXPECT_EQ(expected, value);
+        expected += 3;
+    }
+    EXPECT_EQ(10, expected);
+    span[2] = 70;
+    EXPECT_EQ(70, data[7]);
+}
+
+TEST(StridedSpan, IteratorIsRandomAccess)
+{
+    ::testing::StaticAssertTypeEq<libEmbedded::iterator_traits<StridedSpan<int>::iterator>::iterator_category, libEmbedded::random_access_iterator_tag>();
+    int data[8] = {0, 1, 2, 3, 4, 5, 6, 7};
+    StridedSpan<int> span(data, 4, 2);
+    EXPECT_EQ(4, libEmbedded::Distance(span.begin(), span.end()));
+    EXPECT_EQ(6, *libEmbedded::Next(span.begin(), 3));
+    EXPECT_EQ(4, *libEmbedded::Prev(span.end(), 2));
+    StridedSpan<int>::iterator it = span.begin() + 1;
+    EXPECT_EQ(2, *it);
+    EXPECT_EQ(6, it[2]);
+    EXPECT_TRUE(span.begin() < it);
+    EXPECT_EQ(1, it - span.begin());
+}
+
+TEST(StridedSpan, NegativeStrideAndSubspan)
+{
+    const int data[5] = {0, 1, 2, 3, 4};
+    StridedSpan<const int> reversed(data + 4, 5, -1);
+    EXPECT_EQ(4, reversed[0]);
+    EXPECT_EQ(0, reversed[4]);
+    StridedSpan<const int> middle = reversed.Subspan(1, 3);
+    EXPECT_EQ(3, middle[0]);
+    EXPECT_EQ(1, middle[2]);
+    int values[4] = {1, 2, 3, 4};
+    StridedSpan<const int> readonly = StridedSpan<int>(values, 2, 2);
+    EXPECT_EQ(3, readonly[1]);
+}
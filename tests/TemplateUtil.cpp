@@ -37,3 +37,19 @@ TEST(TemplateUtilTest, FirstOnSingleType)
     auto equality = std::is_same<expectedType, toTestType>::value;
     ASSERT_TRUE(equality) << "Resulting type ID was: '" << std::string(typeid(toTestType).name()) << "' while expecting '" << std::string(typeid(expectedType).name()) << "'";
 }
+
+TEST(TemplateUtilTest, AtOnMultipleTypes)
+{
+    typedef bool expectedType;
+    typedef libEmbedded::templateUtil::At<2, int, short, bool, std::string>::Type toTestType;
+    auto equality = std::is_same<expectedType, toTestType>::value;
+    ASSERT_TRUE(equality) << "Resulting type ID was: '" << std::string(typeid(toTestType).name()) << "' while expecting '" << std::string(typeid(expectedType).name()) << "'";
+}
+
+TEST(TemplateUtilTest, AtFirstAndLast)
+{
+    auto first = std::is_same<int, libEmbedded::templateUtil::At<0, int, short, bool>::Type>::value;
+    auto last = std::is_same<bool, libEmbedded::templateUtil::At<2, int, short, bool>::Type>::value;
+    ASSERT_TRUE(first);
+    ASSERT_TRUE(last);
+}
@@ -0,0 +1,94 @@
+#include <gtest/gtest.h>
+#include "libEmbedded/TieredBuffer.h"
+#include <stdint.h>
+
+using libEmbedded::LastReducer;
+using libEmbedded::MaxReducer;
+using libEmbedded::MeanReducer;
+using libEmbedded::MinReducer;
+using libEmbedded::Tier;
+using libEmbedded::TieredBuffer;
+
+TEST(TieredBuffer, SingleTierIsAPlainBuffer)
+{
+    TieredBuffer<int32_t, LastReducer<int32_t>, Tier<3>> buffer;
+    static_assert(decltype(buffer)::kTierCount == 1, "One tier expected.");
+    for (int32_t i = 1; i <= 5; i++)
+    {
+        buffer.Add(i);
+    }
+    ASSERT_EQ(3, buffer.GetTier<0>().Size());
+    EXPECT_EQ(3, buffer.GetTier<0>()[0]);
+    EXPECT_EQ(5, buffer.GetTier<0>()[2]);
+}
+
+TEST(TieredBuffer, DroppedSamplesAreReducedIntoNextTier)
+{
+    TieredBuffer<int32_t, MeanReducer<int32_t>, Tier<4>, Tier<3, 2>> buffer;
+    for (int32_t i = 1; i <= 8; i++)
+    {
+        buffer.Add(i);
+    }
+    // 1..4 dropped from the first tier, reduced in pairs.
+    ASSERT_EQ(4, buffer.GetTier<0>().Size());
+    EXPECT_EQ(5, buffer.GetTier<0>()[0]);
+    ASSERT_EQ(2, buffer.GetTier<1>().Size());
+    EXPECT_EQ(1, buffer.GetTier<1>()[0]);
+    EXPECT_EQ(3, buffer.GetTier<1>()[1]);
+
+    // One more dropped sample is not enough for a new sample in the next tier.
+    buffer.Add(9);
+    ASSERT_EQ(2, buffer.GetTier<1>().Size());
+    buffer.Add(10);
+    ASSERT_EQ(3, buffer.GetTier<1>().Size());
+    EXPECT_EQ(5, buffer.GetTier<1>()[2]);
+}
+
+TEST(TieredBuffer, ThreeTiersCascade)
+{
+    TieredBuffer<uint32_t, MaxReducer<uint32_t>, Tier<10>, Tier<6, 10>, Tier<4, 3>> buffer;
+    for (uint32_t i = 0; i < 10 + 6 * 10 + 4 * 30; i++)
+    {
+        buffer.Add(i);
+    }
+    ASSERT_EQ(10, buffer.GetTier<0>().Size());
+    EXPECT_EQ(180, buffer.GetTier<0>()[0]);
+    ASSERT_EQ(6, buffer.GetTier<1>().Size());
+    // Max of 120..129 up to max of 170..179.
+    EXPECT_EQ(129, buffer.GetTier<1>()[0]);
+    EXPECT_EQ(179, buffer.GetTier<1>()[5]);
+    ASSERT_EQ(4, buffer.GetTier<2>().Size());
+    // Max of three tier 1 samples, each the max of ten tier 0 samples.
+    EXPECT_EQ(29, buffer.GetTier<2>()[0]);
+    EXPECT_EQ(119, buffer.GetTier<2>()[3]);
+}
+
+TEST(TieredBuffer, Reducers)
+{
+    MinReducer<int32_t> minimum;
+    MaxReducer<int32_t> maximum;
+    LastReducer<int32_t> last;
+    MeanReducer<int32_t, int64_t> mean;
+    const int32_t values[] = {4, -2, 9, 1};
+    for (int32_t value : values)
+    {
+        minimum.Accumulate(value);
+        maximum.Accumulate(value);
+        last.Accumulate(value);
+        mean.Accumulate(value);
+    }
+    EXPECT_EQ(-2, minimum.Result());
+    EXPECT_EQ(9, maximum.Result());
+    EXPECT_EQ(1, last.Result());
+    EXPECT_EQ(3, mean.Result());
+
+    minimum.Reset();
+    maximum.Reset();
+    mean.Reset();
+    minimum.Accumulate(7);
+    maximum.Accumulate(-7);
+    mean.Accumulate(5);
+    EXPECT_EQ(7, minimum.Result());
+    EXPECT_EQ(-7, maximum.Result());
+    EXPECT_EQ(5, mean.Result());
+}
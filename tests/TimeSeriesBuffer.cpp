@@ -0,0 +1,159 @@
+#include <gtest/gtest.h>
+#include "libEmbedded/TimeSeriesBuffer.h"
+#include <math.h>
+#include <stdint.h>
+#include <vector>
+
+using libEmbedded::TimeSeriesBuffer;
+using libEmbedded::TimeSeriesPoint;
+
+template <size_t TNumBlocks, size_t TBlockSize>
+static std::vector<TimeSeriesPoint> DecodeAll(const TimeSeriesBuffer<TNumBlocks, TBlockSize> &buffer)
+{
+    std::vector<TimeSeriesPoint> points;
+    for (const TimeSeriesPoint &point : buffer)
+    {
+        points.push_back(point);
+    }
+    return points;
+}
+
+static void ExpectEqual(const std::vector<TimeSeriesPoint> &expected, const std::vector<TimeSeriesPoint> &actual)
+{
+    ASSERT_EQ(expected.size(), actual.size());
+    for (size_t i = 0; i < expected.size(); i++)
+    {
+        EXPECT_EQ(expected[i].timestamp, actual[i].timestamp) << "at " << i;
+        // Bit exact, so compare the bits and not the values (NaN != NaN).
+        EXPECT_EQ(0, memcmp(&expected[i].value, &actual[i].value, sizeof(double))) << "at " << i;
+    }
+}
+
+TEST(TimeSeriesBuffer, EmptyBuffer)
+{
+    TimeSeriesBuffer<4, 64> buffer;
+    EXPECT_EQ(0, buffer.Size());
+    EXPECT_EQ(0, buffer.BlockCount());
+    EXPECT_EQ(0, buffer.BytesUsed());
+    EXPECT_TRUE(buffer.begin() == buffer.end());
+}
+
+TEST(TimeSeriesBuffer, FixedRateAndRepeatedValueTakeTwoBits)
+{
+    TimeSeriesBuffer<4, 64> buffer;
+    std::vector<TimeSeriesPoint> points;
+    for (uint64_t i = 0; i < 20; i++)
+    {
+        points.push_back({1000 + 10 * i, 21.5});
+        buffer.Add(points.back().timestamp, points.back().value);
+    }
+    // First point 128 bits, the second 2 control + 7 delta-of-delta bits + 1 value bit, the others 1 + 1 bit.
+    EXPECT_EQ((128 + 10 + 18 * 2 + 7) / 8, buffer.BytesUsed());
+    EXPECT_EQ(20, buffer.Size());
+    EXPECT_EQ(1190, buffer.Back().timestamp);
+    EXPECT_EQ(21.5, buffer.Back().value);
+    ExpectEqual(points, DecodeAll(buffer));
+}
+
+TEST(TimeSeriesBuffer, IrregularPointsRoundTrip)
+{
+    TimeSeriesBuffer<8, 128> buffer;
+    const std::vector<TimeSeriesPoint> points = {
+        {0, 0.0},
+        {UINT64_MAX, -0.0},
+        {5, 1.0},
+        {6, 1.0000000001},
+        {6, NAN},
+        {1000000, INFINITY},
+        {1000001, -INFINITY},
+        {999999, 3.14159},
+        {1999999, -3.14159},
+        {2000000, 1e-300},
+        {2000100, 1e300},
+        {0x8000000000000000, 12345.678},
+    };
+    for (const TimeSeriesPoint &point : points)
+    {
+        buffer.Add(point.timestamp, point.value);
+    }
+    ExpectEqual(points, DecodeAll(buffer));
+}
+
+TEST(TimeSeriesBuffer, EveryDeltaOfDeltaClassRoundTrips)
+{
+    TimeSeriesBuffer<4, 256> buffer;
+    std::vector<TimeSeriesPoint> points;
+    uint64_t timestamp = 100;
+    const int64_t jumps[] = {0, 1, -1, 63, -64, 64, 255, -256, 256, 2047, -2048, 2048, 100000, -100000, 0};
+    int64_t delta = 0;
+    for (int64_t jump : jumps)
+    {
+        delta += jump;
+        timestamp += static_cast<uint64_t>(delta);
+        points.push_back({timestamp, static_cast<double>(jump)});
+        buffer.Add(timestamp, static_cast<double>(jump));
+    }
+    ExpectEqual(points, DecodeAll(buffer));
+}
+
+TEST(TimeSeriesBuffer, FullBlockStartsANewBlock)
+{
+    TimeSeriesBuffer<4, 24> buffer;
+    // The first point takes 128 bits, the second 10 bits, so 54 bits are left.
+    buffer.Add(0, 1.0);
+    buffer.Add(1, 1.0);
+    EXPECT_EQ(1, buffer.BlockCount());
+    // 1/3 differs from 1.0 in 54 meaningful bits, with its own window that takes 1 + 2 + 5 + 6 + 54 bits.
+    buffer.Add(2, 1.0 / 3.0);
+    EXPECT_EQ(2, buffer.BlockCount());
+    buffer.Add(3, 2.0 / 3.0);
+    EXPECT_EQ(2, buffer.BlockCount());
+    ExpectEqual({{0, 1.0}, {1, 1.0}, {2, 1.0 / 3.0}, {3, 2.0 / 3.0}}, DecodeAll(buffer));
+}
+
+TEST(TimeSeriesBuffer, DropsOldestBlockWhenFull)
+{
+    TimeSeriesBuffer<2, 16> buffer;
+    // Only the first point fits in a 16 byte block.
+    buffer.Add(1, 1.0);
+    buffer.Add(2, 2.0);
+    buffer.Add(3, 3.0);
+    EXPECT_EQ(2, buffer.BlockCount());
+    EXPECT_EQ(2, buffer.Size());
+    ExpectEqual({{2, 2.0}, {3, 3.0}}, DecodeAll(buffer));
+}
+
+TEST(TimeSeriesBuffer, RemoveBlockAndClear)
+{
+    TimeSeriesBuffer<4, 16> buffer;
+    EXPECT_EQ(0, buffer.RemoveBlock());
+    buffer.Add(1, 1.0);
+    buffer.Add(2, 2.0);
+    EXPECT_EQ(1, buffer.RemoveBlock());
+    ExpectEqual({{2, 2.0}}, DecodeAll(buffer));
+    EXPECT_EQ(1, buffer.RemoveBlock());
+    EXPECT_EQ(0, buffer.Size());
+    EXPECT_EQ(0, buffer.BytesUsed());
+
+    buffer.Add(3, 3.0);
+    buffer.Clear();
+    EXPECT_TRUE(buffer.begin() == buffer.end());
+    buffer.Add(4, 4.0);
+    ExpectEqual({{4, 4.0}}, DecodeAll(buffer));
+}
+
+TEST(TimeSeriesBuffer, SensorSeriesFitsMoreThanABuffer)
+{
+    constexpr size_t kBytes = 4096;
+    TimeSeriesBuffer<16, kBytes / 16> buffer;
+    std::vector<TimeSeriesPoint> added;
+    for (uint64_t i = 0; i < 10000; i++)
+    {
+        // A 10 Hz sensor with a resolution of 1/16 degree that changes now and then.
+        const double value = 20.0 + static_cast<double>((i / 7) % 5) / 16.0;
+        added.push_back({1700000000000 + 100 * i, value});
+        buffer.Add(added.back().timestamp, value);
+    }
+    EXPECT_GT(buffer.Size(), 5 * kBytes / sizeof(TimeSeriesPoint));
+    ExpectEqual(std::vector<TimeSeriesPoint>(added.end() - buffer.Size(), added.end()), DecodeAll(buffer));
+}
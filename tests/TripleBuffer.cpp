@@ -0,0 +1,89 @@
+#include <gtest/gtest.h>
+#include "libEmbedded/TripleBuffer.h"
+#include <atomic>
+#include <thread>
+
+using libEmbedded::TripleBuffer;
+
+struct Pose
+{
+    uint32_t sequence;
+    double x;
+    double y;
+    // Same as sequence, a torn read would have a mismatch.
+    uint32_t check;
+};
+
+TEST(TripleBuffer, ReadsDefaultBeforeFirstPublish)
+{
+    TripleBuffer<int> buffer;
+    EXPECT_FALSE(buffer.Update());
+    EXPECT_EQ(0, buffer.Read());
+}
+
+TEST(TripleBuffer, ReadsNewestValue)
+{
+    TripleBuffer<int> buffer;
+    buffer.Write(1);
+    buffer.Write(2);
+    buffer.Write(3);
+    EXPECT_TRUE(buffer.Update());
+    EXPECT_EQ(3, buffer.Front());
+    // Nothing new, the front stays.
+    EXPECT_FALSE(buffer.Update());
+    EXPECT_EQ(3, buffer.Read());
+
+    buffer.Write(4);
+    EXPECT_EQ(4, buffer.Read());
+}
+
+TEST(TripleBuffer, BuildInBackSlot)
+{
+    TripleBuffer<Pose> buffer;
+    Pose &back = buffer.Back();
+    back.sequence = 7;
+    back.x = 1.5;
+    // Not visible until published.
+    EXPECT_FALSE(buffer.Update());
+    buffer.Publish();
+    EXPECT_EQ(7, buffer.Read().sequence);
+    EXPECT_EQ(1.5, buffer.Front().x);
+    // The writer never gets the slot the reader holds.
+    EXPECT_NE(&buffer.Back(), &buffer.Front());
+    buffer.Publish();
+    EXPECT_NE(&buffer.Back(), &buffer.Front());
+}
+
+TEST(TripleBuffer, ConcurrentWriterAndReader)
+{
+    constexpr uint32_t kWrites = 100000;
+    static TripleBuffer<Pose> buffer;
+    std::thread writer([]() {
+        for (uint32_t i = 1; i <= kWrites; i++)
+        {
+            Pose &pose = buffer.Back();
+            pose.sequence = i;
+            pose.x = i * 0.5;
+            pose.y = i * 2.0;
+            pose.check = i;
+            buffer.Publish();
+            if (i % 64 == 0)
+            {
+                std::this_thread::yield();
+            }
+        }
+    });
+    uint32_t last = 0;
+    while (last < kWrites)
+    {
+        const Pose &pose = buffer.Read();
+        ASSERT_EQ(pose.sequence, pose.check);
+        ASSERT_EQ(pose.sequence * 0.5, pose.x);
+        ASSERT_EQ(pose.sequence * 2.0, pose.y);
+        // Never older than what was seen before.
+        ASSERT_GE(pose.sequence, last);
+        last = pose.sequence;
+        std::this_thread::yield();
+    }
+    writer.join();
+}
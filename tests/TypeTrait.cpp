@@ -105,3 +105,82 @@ TEST(TypeTrait, is_reference)
     static_assert(is_reference<const uint8_t&>::value, "Failed.");
     static_assert(is_reference<const uint8_t*>::value == false, "Failed.");
 }
+
+TEST(TypeTrait, is_integral)
+{
+    static_assert(is_integral<uint8_t>::value, "Failed.");
+    static_assert(is_integral<const int32_t>::value, "Failed.");
+    static_assert(is_integral<bool>::value, "Failed.");
+    static_assert(is_integral<float>::value == false, "Failed.");
+    static_assert(is_integral<uint8_t*>::value == false, "Failed.");
+    static_assert(is_integral<uint8_t&>::value == false, "Failed.");
+}
+
+namespace
+{
+    struct PlainData
+    {
+        int a;
+        float b;
+    };
+
+    struct WithCopyConstructor
+    {
+        WithCopyConstructor() {}
+        WithCopyConstructor(const WithCopyConstructor &) {}
+    };
+
+    struct WithDestructor
+    {
+        ~WithDestructor() {}
+    };
+} // namespace
+
+TEST(TypeTrait, is_trivially_copyable)
+{
+    static_assert(is_trivially_copyable<uint8_t>::value, "Failed.");
+    static_assert(is_trivially_copyable<uint8_t*>::value, "Failed.");
+    static_assert(is_trivially_copyable<PlainData>::value, "Failed.");
+    static_assert(is_trivially_copyable<WithCopyConstructor>::value == false, "Failed.");
+    static_assert(is_trivially_copyable<WithDestructor>::value == false, "Failed.");
+}
+
+TEST(TypeTrait, is_trivially_destructible)
+{
+    static_assert(is_trivially_destructible<uint8_t>::value, "Failed.");
+    static_assert(is_trivially_destructible<PlainData>::value, "Failed.");
+    static_assert(is_trivially_destructible<WithCopyConstructor>::value, "Failed.");
+    static_assert(is_trivially_destructible<WithDestructor>::value == false, "Failed.");
+}
+
+TEST(TypeTrait, move_and_forward)
+{
+    int value = 1;
+    StaticAssertTypeEq<decltype(libEmbedded::move(value)), int&&>();
+    StaticAssertTypeEq<decltype(libEmbedded::forward<int&>(value)), int&>();
+    StaticAssertTypeEq<decltype(libEmbedded::forward<int>(value)), int&&>();
+}
+
+TEST(TypeTrait, iterator_traits)
+{
+    using libEmbedded::bidirectional_iterator_tag;
+    using libEmbedded::forward_iterator_tag;
+    using libEmbedded::iterator_traits;
+    using libEmbedded::random_access_iterator_tag;
+    struct NoCategory
+    {
+    };
+    struct Bidirectional
+    {
+        typedef bidirectional_iterator_tag iterator_category;
+    };
+    struct OtherLibrary
+    {
+        typedef int iterator_category;
+    };
+    StaticAssertTypeEq<iterator_traits<int *>::iterator_category, random_access_iterator_tag>();
+    StaticAssertTypeEq<iterator_traits<const int *>::iterator_category, random_access_iterator_tag>();
+    StaticAssertTypeEq<iterator_traits<NoCategory>::iterator_category, forward_iterator_tag>();
+    StaticAssertTypeEq<iterator_traits<Bidirectional>::iterator_category, bidirectional_iterator_tag>();
+    StaticAssertTypeEq<iterator_traits<OtherLibrary>::iterator_category, forward_iterator_tag>();
+}